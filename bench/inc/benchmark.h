@@ -0,0 +1,107 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/** @file benchmark.h
+ ** @brief Declaraciones de las funciones auxiliares para las mediciones de desempeño
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup bench
+ ** @brief Mediciones de desempeño del sistema operativo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+
+#include "sapi.h"
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definiciones y Macros =================================================================== */
+
+/* === Declaraciones de tipos de datos ========================================================= */
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/**
+ * @brief Función para configurar el contador de ciclos y el puerto serial de los resultados
+ *
+ * @remark Esta función se debe llamar desde el programa principal antes de iniciar el sistema
+ * operativo porque configura perifericos que requieren el modo privilegiado.
+ */
+void BenchmarkInit(void);
+
+/**
+ * @brief Función para leer el contador libre de ciclos del procesador
+ *
+ * @remark Se utiliza el TIMER0 sin preescala en lugar del contador DWT_CYCCNT porque las tareas
+ * se ejecutan en modo no privilegiado y no pueden acceder a los registros del nucleo.
+ *
+ * @return Cantidad de ciclos del procesador desde la llamada a @ref BenchmarkInit
+ */
+static inline uint32_t BenchmarkCycles(void)
+{
+    return Chip_TIMER_ReadCount(LPC_TIMER0);
+}
+
+/**
+ * @brief Función para informar el resultado de una medición por el puerto serial
+ *
+ * @remark El resultado se envia como una linea con el formato `nombre;parametro;ciclos`
+ *
+ * @param[in] name          Nombre de la medición realizada
+ * @param[in] parameter     Valor del parametro que se varia en la medición
+ * @param[in] cycles        Cantidad de ciclos medidos
+ */
+void BenchmarkReport(char const* name, uint32_t parameter, uint32_t cycles);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif /* BENCHMARK_H */
@@ -0,0 +1,235 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench_colas.c
+ ** @brief Medicion del costo de transferir datos entre dos tareas por medio de una cola
+ **
+ ** Una tarea productora de mayor prioridad envia una cantidad fija de datos a una tarea
+ ** consumidora, por lo que la productora se bloquea cada vez que se llena la cola. Se compara
+ ** una cola construida con dos semaforos, que requiere dos llamadas al sistema por cada dato, con
+ ** las colas del sistema operativo que completan la transferencia con una unica llamada. Se informa
+ ** la cantidad promedio de ciclos por dato transferido en función del tamaño de la cola.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup bench
+ ** @brief Mediciones de desempeño del sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "eos.h"
+#include "benchmark.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Cantidad de datos que se transfieren en cada medición para promediar el resultado
+#define REPETICIONES 1000
+
+//! Cantidad de elementos de la cola mas grande que se utiliza en las mediciones
+#define MAXIMO 8
+
+//! Cantidad de mediciones que se realizan, cada una con un tamaño de cola diferente
+#define MEDICIONES (sizeof(TAMANIOS) / sizeof(TAMANIOS[0]))
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Estructura de datos de una cola implementada con dos semaforos
+typedef struct cola_semaforos_s {
+    //! Vector donde se almacenan los datos de la cola
+    uint32_t datos[MAXIMO];
+    //! Cantidad de elementos que se pueden almacenar en la cola
+    uint32_t tamanio;
+    //! Indice del vector en el que se debe ingresar el siguiente dato
+    uint32_t entrada;
+    //! Indice del vector del que se debe tomar el siguiente dato
+    uint32_t salida;
+    //! Semaforo para esperar cuando la cola esta llena
+    eos_semaphore_t libres;
+    //! Semaforo para esperar cuando la cola esta vacia
+    eos_semaphore_t ocupados;
+} * cola_semaforos_t;
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/**
+ * @brief Función para agregar un dato en una cola implementada con dos semaforos
+ *
+ * @param cola  Puntero a la cola en la que se agrega el dato
+ * @param dato  Valor que se agrega en la cola
+ */
+static void ColaSemaforosGive(cola_semaforos_t cola, uint32_t dato);
+
+/**
+ * @brief Función para retirar un dato de una cola implementada con dos semaforos
+ *
+ * @param cola  Puntero a la cola de la que se retira el dato
+ * @return      Valor retirado de la cola
+ */
+static uint32_t ColaSemaforosTake(cola_semaforos_t cola);
+
+/**
+ * @brief Tarea que envia los datos de cada medición y espera que la consumidora los reciba
+ *
+ * @param data Puntero no utilizado en esta tarea
+ */
+void Productora(void* data);
+
+/**
+ * @brief Tarea que recibe los datos de cada medición e informa el resultado
+ *
+ * @param data Puntero no utilizado en esta tarea
+ */
+void Consumidora(void* data);
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Tamaños de las colas utilizadas en las mediciones
+static const uint32_t TAMANIOS[] = { 1, MAXIMO };
+
+//! Colas implementadas con dos semaforos, una para cada medición
+static struct cola_semaforos_s colas_semaforos[MEDICIONES];
+
+//! Almacenamiento de las colas del sistema operativo, una para cada medición
+static uint32_t datos[MEDICIONES][MAXIMO];
+
+//! Colas del sistema operativo, una para cada medición
+static eos_queue_t colas[MEDICIONES];
+
+//! Semaforo que indica a la productora que la consumidora termino una medición
+static eos_semaphore_t terminada;
+
+//! Ciclos del contador al iniciar la medición en curso
+static uint32_t inicio;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void ColaSemaforosGive(cola_semaforos_t cola, uint32_t dato)
+{
+    EosSemaphoreTake(cola->libres);
+    cola->datos[cola->entrada] = dato;
+    cola->entrada = (cola->entrada + 1) % cola->tamanio;
+    EosSemaphoreGive(cola->ocupados);
+}
+
+static uint32_t ColaSemaforosTake(cola_semaforos_t cola)
+{
+    uint32_t dato;
+
+    EosSemaphoreTake(cola->ocupados);
+    dato = cola->datos[cola->salida];
+    cola->salida = (cola->salida + 1) % cola->tamanio;
+    EosSemaphoreGive(cola->libres);
+    return dato;
+}
+
+void Productora(void* data)
+{
+    for (uint32_t medicion = 0; medicion < MEDICIONES; medicion++) {
+        inicio = BenchmarkCycles();
+        for (uint32_t dato = 0; dato < REPETICIONES; dato++) {
+            ColaSemaforosGive(&colas_semaforos[medicion], dato);
+        }
+        EosSemaphoreTake(terminada);
+
+        inicio = BenchmarkCycles();
+        for (uint32_t dato = 0; dato < REPETICIONES; dato++) {
+            EosQueueGive(colas[medicion], &dato);
+        }
+        EosSemaphoreTake(terminada);
+    }
+
+    while (1) {
+        EosWaitDelay(UINT32_MAX);
+    }
+}
+
+void Consumidora(void* data)
+{
+    uint32_t dato;
+
+    for (uint32_t medicion = 0; medicion < MEDICIONES; medicion++) {
+        for (uint32_t indice = 0; indice < REPETICIONES; indice++) {
+            dato = ColaSemaforosTake(&colas_semaforos[medicion]);
+        }
+        BenchmarkReport("cola_semaforos", TAMANIOS[medicion],
+            (BenchmarkCycles() - inicio) / REPETICIONES);
+        EosSemaphoreGive(terminada);
+
+        for (uint32_t indice = 0; indice < REPETICIONES; indice++) {
+            EosQueueTake(colas[medicion], &dato);
+        }
+        BenchmarkReport("cola", TAMANIOS[medicion], (BenchmarkCycles() - inicio) / REPETICIONES);
+        EosSemaphoreGive(terminada);
+    }
+    (void)dato;
+
+    while (1) {
+        EosWaitDelay(UINT32_MAX);
+    }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+int main(void)
+{
+    boardConfig();
+    BenchmarkInit();
+
+    for (uint32_t medicion = 0; medicion < MEDICIONES; medicion++) {
+        colas_semaforos[medicion].tamanio = TAMANIOS[medicion];
+        colas_semaforos[medicion].libres = EosSemaphoreCreate(TAMANIOS[medicion]);
+        colas_semaforos[medicion].ocupados = EosSemaphoreCreate(0);
+        colas[medicion] = EosQueueCreate(datos[medicion], TAMANIOS[medicion], sizeof(uint32_t));
+    }
+    terminada = EosSemaphoreCreate(0);
+
+    EosTaskCreate(Productora, NULL, 2);
+    EosTaskCreate(Consumidora, NULL, 1);
+
+    EosStartScheduler();
+
+    return 0;
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,247 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench_mutex.c
+ ** @brief Medicion de los cambios de contexto al proteger un recurso compartido
+ **
+ ** Una tarea de baja prioridad toma el recurso y, dentro de la sección critica, activa a una
+ ** tarea de alta prioridad que tambien lo necesita. Se compara la exclusión implementada con un
+ ** semaforo binario, con un mutex con herencia de prioridades y con un mutex con techo de
+ ** prioridad inmediato. Con el semaforo y con la herencia la tarea de alta prioridad desaloja a la
+ ** dueña del recurso, se bloquea y vuelve a desalojarla al liberarlo, mientras que con el techo
+ ** solo se ejecuta despues de la liberación. Se informa como parametro la cantidad de cambios de
+ ** contexto entre las dos tareas por cada sección critica y los ciclos promedio de cada una.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup bench
+ ** @brief Mediciones de desempeño del sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "eos.h"
+#include "benchmark.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Cantidad de secciones criticas que se ejecutan en cada medición para promediar el resultado
+#define REPETICIONES 1000
+
+//! Prioridad de la tarea que toma primero el recurso
+#define PRIORIDAD_BAJA 1
+
+//! Prioridad de la tarea que se activa dentro de la sección critica
+#define PRIORIDAD_ALTA 2
+
+//! Techo del mutex, mayor que la prioridad de las tareas que se alternan en cada llamada
+#define PRIORIDAD_TECHO 3
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Metodos de exclusión que se comparan en las mediciones
+typedef enum metodo_e {
+    SEMAFORO,
+    HERENCIA,
+    TECHO,
+    METODOS,
+} metodo_t;
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/**
+ * @brief Función para tomar el recurso con el metodo de exclusión de la medición en curso
+ *
+ * @param metodo Metodo de exclusión utilizado en la medición
+ */
+static void Tomar(metodo_t metodo);
+
+/**
+ * @brief Función para liberar el recurso con el metodo de exclusión de la medición en curso
+ *
+ * @param metodo Metodo de exclusión utilizado en la medición
+ */
+static void Liberar(metodo_t metodo);
+
+/**
+ * @brief Función para contar los cambios de contexto entre las tareas de la medición
+ *
+ * @remark Cada tarea llama a esta función al retornar de una llamada al sistema, por lo que se
+ * cuenta un cambio cada vez que la tarea en ejecución es diferente de la anterior.
+ *
+ * @param tarea Prioridad de la tarea que llama a la función
+ */
+static void Registrar(uint8_t tarea);
+
+/**
+ * @brief Tarea que toma el recurso y activa a la tarea de alta prioridad en la sección critica
+ *
+ * @param data Puntero no utilizado en esta tarea
+ */
+void Baja(void* data);
+
+/**
+ * @brief Tarea que espera la activación, toma el recurso y lo libera en forma inmediata
+ *
+ * @param data Puntero no utilizado en esta tarea
+ */
+void Alta(void* data);
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Nombres con los que se informa el resultado de cada medición
+static char const * const NOMBRES[METODOS] = { "mutex_semaforo", "mutex_herencia", "mutex_techo" };
+
+//! Semaforo binario utilizado como exclusión en la primera medición
+static eos_semaphore_t semaforo;
+
+//! Mutex utilizados como exclusión en las otras mediciones
+static eos_mutex_t mutex[METODOS];
+
+//! Semaforo con el que la tarea de baja prioridad activa a la de alta prioridad
+static eos_semaphore_t activar;
+
+//! Semaforo que indica a la tarea de baja prioridad que termino una medición
+static eos_semaphore_t terminada;
+
+//! Prioridad de la ultima tarea que retornó de una llamada al sistema
+static uint8_t ultima;
+
+//! Cantidad de cambios de contexto entre las tareas en la medición en curso
+static uint32_t cambios;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void Tomar(metodo_t metodo)
+{
+    if (metodo == SEMAFORO) {
+        EosSemaphoreTake(semaforo);
+    } else {
+        EosMutexLock(mutex[metodo]);
+    }
+}
+
+static void Liberar(metodo_t metodo)
+{
+    if (metodo == SEMAFORO) {
+        EosSemaphoreGive(semaforo);
+    } else {
+        EosMutexUnlock(mutex[metodo]);
+    }
+}
+
+static void Registrar(uint8_t tarea)
+{
+    if (ultima != tarea) {
+        ultima = tarea;
+        cambios++;
+    }
+}
+
+void Baja(void* data)
+{
+    uint32_t inicio;
+
+    for (metodo_t metodo = SEMAFORO; metodo < METODOS; metodo++) {
+        cambios = 0;
+        ultima = PRIORIDAD_BAJA;
+        inicio = BenchmarkCycles();
+        for (uint32_t indice = 0; indice < REPETICIONES; indice++) {
+            Tomar(metodo);
+            Registrar(PRIORIDAD_BAJA);
+            EosSemaphoreGive(activar);
+            Registrar(PRIORIDAD_BAJA);
+            Liberar(metodo);
+            Registrar(PRIORIDAD_BAJA);
+        }
+        EosSemaphoreTake(terminada);
+        BenchmarkReport(NOMBRES[metodo], cambios / REPETICIONES,
+            (BenchmarkCycles() - inicio) / REPETICIONES);
+    }
+
+    while (1) {
+        EosWaitDelay(UINT32_MAX);
+    }
+}
+
+void Alta(void* data)
+{
+    for (metodo_t metodo = SEMAFORO; metodo < METODOS; metodo++) {
+        for (uint32_t indice = 0; indice < REPETICIONES; indice++) {
+            EosSemaphoreTake(activar);
+            Registrar(PRIORIDAD_ALTA);
+            Tomar(metodo);
+            Registrar(PRIORIDAD_ALTA);
+            Liberar(metodo);
+            Registrar(PRIORIDAD_ALTA);
+        }
+        EosSemaphoreGive(terminada);
+    }
+
+    while (1) {
+        EosWaitDelay(UINT32_MAX);
+    }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+int main(void)
+{
+    boardConfig();
+    BenchmarkInit();
+
+    semaforo = EosSemaphoreCreate(1);
+    mutex[HERENCIA] = EosMutexCreate();
+    mutex[TECHO] = EosMutexCreateCeiling(PRIORIDAD_TECHO);
+    activar = EosSemaphoreCreate(0);
+    terminada = EosSemaphoreCreate(0);
+
+    EosTaskCreate(Baja, NULL, PRIORIDAD_BAJA);
+    EosTaskCreate(Alta, NULL, PRIORIDAD_ALTA);
+
+    EosStartScheduler();
+
+    return 0;
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,118 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench_planificador.c
+ ** @brief Medicion del costo del cambio de contexto en función de la prioridad de la tarea
+ **
+ ** Cada tarea de medición tiene una prioridad diferente y cede el procesador repetidas veces
+ ** siendo la unica tarea lista, por lo que cada llamada incluye el servicio, la excepción PendSV
+ ** y la busqueda de la cola de mayor prioridad que realiza el planificador. Al terminar informa
+ ** los ciclos promedio y se bloquea para que se ejecute la tarea de la prioridad siguiente.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup bench
+ ** @brief Mediciones de desempeño del sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "eos.h"
+#include "benchmark.h"
+#include <stdint.h>
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Cantidad de veces que cada tarea cede el procesador para promediar la medición
+#define REPETICIONES 1000
+
+//! Cantidad de tareas de medición, cada una con una prioridad diferente
+#define TAREAS ((EOS_MAX_TASK_COUNT < EOS_MAX_PRIORITY) ? EOS_MAX_TASK_COUNT : EOS_MAX_PRIORITY)
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/**
+ * @brief Tarea que mide el tiempo promedio para ceder el procesador con su prioridad
+ *
+ * @param data Prioridad asignada a la tarea, solo se utiliza para informar el resultado
+ */
+void Medicion(void* data);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+void Medicion(void* data)
+{
+    uint32_t prioridad = (uint32_t)data;
+    uint32_t inicio = BenchmarkCycles();
+
+    for (int indice = 0; indice < REPETICIONES; indice++) {
+        EosCpuYield();
+    }
+    BenchmarkReport("yield", prioridad, (BenchmarkCycles() - inicio) / REPETICIONES);
+
+    while (1) {
+        EosWaitDelay(UINT32_MAX);
+    }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+int main(void)
+{
+    boardConfig();
+    BenchmarkInit();
+
+    // Las tareas se reparten en todo el rango de prioridades, de la mayor a la menor
+    for (uint32_t indice = 0; indice < TAREAS; indice++) {
+        uint32_t prioridad = EOS_MAX_PRIORITY - 1 - indice * (EOS_MAX_PRIORITY / TAREAS);
+        EosTaskCreate(Medicion, (void*)prioridad, prioridad);
+    }
+
+    EosStartScheduler();
+
+    return 0;
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,148 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench_temporizador.c
+ ** @brief Medicion del costo de la interrupción del SysTick en función de las tareas en espera
+ **
+ ** Se crean tareas que se bloquean en esperas temporizadas muy largas y una tarea de medición de
+ ** menor prioridad que lee continuamente el contador de ciclos. Cuando la diferencia entre dos
+ ** lecturas consecutivas supera el tiempo de una vuelta del lazo se considera que el procesador
+ ** atendió la interrupción del SysTick y se acumula el tiempo perdido para informar el promedio.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup bench
+ ** @brief Mediciones de desempeño del sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "eos.h"
+#include "benchmark.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Cantidad de tareas bloqueadas en esperas temporizadas durante la medición
+#define TAREAS_DORMIDAS (EOS_MAX_TASK_COUNT - 1)
+
+//! Cantidad de interrupciones que se promedian en la medición
+#define REPETICIONES 1000
+
+//! Ciclos entre dos lecturas a partir de los cuales se considera que ocurrió una interrupción
+#define UMBRAL_INTERRUPCION 60
+
+//! Duración de la espera de las tareas dormidas, no debe vencer durante la medición
+#define ESPERA_DORMIDAS 0x40000000
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/**
+ * @brief Tarea que se bloquea en una espera temporizada que no vence durante la medición
+ *
+ * @param data Indice de la tarea, se utiliza para que todas las esperas sean diferentes
+ */
+void Dormida(void* data);
+
+/**
+ * @brief Tarea que mide el tiempo consumido por la interrupción del SysTick
+ *
+ * @param data No se utiliza
+ */
+void Medicion(void* data);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+void Dormida(void* data)
+{
+    uint32_t indice = (uint32_t)data;
+
+    while (1) {
+        EosWaitDelay(ESPERA_DORMIDAS + indice);
+    }
+}
+
+void Medicion(void* data)
+{
+    uint32_t interrupciones = 0;
+    uint32_t perdidos = 0;
+    uint32_t anterior = BenchmarkCycles();
+
+    (void)data;
+    while (interrupciones < REPETICIONES) {
+        uint32_t actual = BenchmarkCycles();
+        if (actual - anterior > UMBRAL_INTERRUPCION) {
+            perdidos += actual - anterior;
+            interrupciones++;
+        }
+        anterior = actual;
+    }
+    BenchmarkReport("systick", TAREAS_DORMIDAS, perdidos / REPETICIONES);
+
+    while (1) {
+        EosWaitDelay(ESPERA_DORMIDAS);
+    }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+int main(void)
+{
+    boardConfig();
+    BenchmarkInit();
+
+    // Las tareas dormidas tienen mayor prioridad para bloquearse antes de iniciar la medición
+    for (uint32_t indice = 0; indice < TAREAS_DORMIDAS; indice++) {
+        EosTaskCreate(Dormida, (void*)indice, 1);
+    }
+    EosTaskCreate(Medicion, NULL, 0);
+
+    EosStartScheduler();
+
+    return 0;
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,235 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench_umbral.c
+ ** @brief Medicion de los cambios de contexto del programa principal con umbrales de desalojo
+ **
+ ** Se reproduce la cadena de tareas del programa principal: una tarea de procesamiento de baja
+ ** prioridad genera los eventos y los envia por dos colas a una tarea de visualización y a una
+ ** tarea de consola de mayor prioridad. Sin umbrales cada evento enviado desaloja a la tarea de
+ ** procesamiento, mientras que con el umbral de las tres tareas en la mayor prioridad del grupo
+ ** las tareas se ejecutan sin desalojarse y solo ceden el procesador al bloquearse, cuando se
+ ** llena o se vacia una cola. Se informa como parametro la cantidad total de cambios de contexto
+ ** entre las tareas y los ciclos promedio por evento procesado.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup bench
+ ** @brief Mediciones de desempeño del sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "eos.h"
+#include "benchmark.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Cantidad de eventos que se procesan en cada medición para promediar el resultado
+#define REPETICIONES 1000
+
+//! Cantidad de elementos de las colas, igual a las del programa principal
+#define CANTIDAD 4
+
+//! Prioridad de la tarea de procesamiento
+#define PRIORIDAD_PROCESAMIENTO 1
+
+//! Prioridad de la tarea de visualización
+#define PRIORIDAD_VISUALIZACION 2
+
+//! Prioridad de la tarea de consola y umbral de desalojo del grupo en la segunda medición
+#define PRIORIDAD_CONSOLA 3
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/**
+ * @brief Función para contar los cambios de contexto entre las tareas de la medición
+ *
+ * @remark Cada tarea llama a esta función al retornar de una llamada al sistema, por lo que se
+ * cuenta un cambio cada vez que la tarea en ejecución es diferente de la anterior.
+ *
+ * @param tarea Prioridad de la tarea que llama a la función
+ */
+static void Registrar(uint8_t tarea);
+
+/**
+ * @brief Función que recibe los eventos de una cola en cada medición
+ *
+ * @param cola  Cola de la que se reciben los eventos
+ * @param tarea Prioridad de la tarea que recibe los eventos
+ */
+static void Recibir(eos_queue_t cola, uint8_t tarea);
+
+/**
+ * @brief Tarea que genera los eventos, los envia a las otras tareas e informa los resultados
+ *
+ * @param data Puntero no utilizado en esta tarea
+ */
+void Procesamiento(void* data);
+
+/**
+ * @brief Tarea que recibe los eventos destinados a la visualización
+ *
+ * @param data Puntero no utilizado en esta tarea
+ */
+void Visualizacion(void* data);
+
+/**
+ * @brief Tarea que recibe los eventos destinados a la consola
+ *
+ * @param data Puntero no utilizado en esta tarea
+ */
+void Consola(void* data);
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Almacenamiento de la cola de eventos de visualización
+static uint32_t vector_colores[CANTIDAD];
+
+//! Almacenamiento de la cola de eventos de consola
+static uint32_t vector_mensajes[CANTIDAD];
+
+//! Cola de eventos de visualización
+static eos_queue_t cola_colores;
+
+//! Cola de eventos de consola
+static eos_queue_t cola_mensajes;
+
+//! Semaforo que indica a la tarea de procesamiento que una tarea recibio todos los eventos
+static eos_semaphore_t terminada;
+
+//! Descriptores de las tareas de la medición
+static eos_task_t tareas[PRIORIDAD_CONSOLA + 1];
+
+//! Prioridad de la ultima tarea que retornó de una llamada al sistema
+static uint8_t ultima;
+
+//! Cantidad de cambios de contexto entre las tareas en la medición en curso
+static uint32_t cambios;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static void Registrar(uint8_t tarea)
+{
+    if (ultima != tarea) {
+        ultima = tarea;
+        cambios++;
+    }
+}
+
+static void Recibir(eos_queue_t cola, uint8_t tarea)
+{
+    uint32_t evento;
+
+    while (1) {
+        for (uint32_t indice = 0; indice < REPETICIONES; indice++) {
+            EosQueueTake(cola, &evento);
+            Registrar(tarea);
+        }
+        EosSemaphoreGive(terminada);
+    }
+}
+
+void Procesamiento(void* data)
+{
+    static char const * const NOMBRES[] = { "umbral_sin", "umbral_con" };
+    uint32_t inicio;
+
+    for (uint32_t medicion = 0; medicion < 2; medicion++) {
+        cambios = 0;
+        ultima = PRIORIDAD_PROCESAMIENTO;
+        inicio = BenchmarkCycles();
+        for (uint32_t evento = 0; evento < REPETICIONES; evento++) {
+            EosQueueGive(cola_colores, &evento);
+            Registrar(PRIORIDAD_PROCESAMIENTO);
+            EosQueueGive(cola_mensajes, &evento);
+            Registrar(PRIORIDAD_PROCESAMIENTO);
+        }
+        EosSemaphoreTake(terminada);
+        EosSemaphoreTake(terminada);
+        BenchmarkReport(NOMBRES[medicion], cambios, (BenchmarkCycles() - inicio) / REPETICIONES);
+
+        // En la segunda medición las tres tareas forman un grupo no desalojable
+        for (uint8_t tarea = PRIORIDAD_PROCESAMIENTO; tarea <= PRIORIDAD_CONSOLA; tarea++) {
+            EosTaskSetPreemptionThreshold(tareas[tarea], PRIORIDAD_CONSOLA);
+        }
+    }
+
+    while (1) {
+        EosWaitDelay(UINT32_MAX);
+    }
+}
+
+void Visualizacion(void* data)
+{
+    Recibir(cola_colores, PRIORIDAD_VISUALIZACION);
+}
+
+void Consola(void* data)
+{
+    Recibir(cola_mensajes, PRIORIDAD_CONSOLA);
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+int main(void)
+{
+    boardConfig();
+    BenchmarkInit();
+
+    cola_colores = EosQueueCreate(vector_colores, CANTIDAD, sizeof(uint32_t));
+    cola_mensajes = EosQueueCreate(vector_mensajes, CANTIDAD, sizeof(uint32_t));
+    terminada = EosSemaphoreCreate(0);
+
+    tareas[PRIORIDAD_PROCESAMIENTO] = EosTaskCreate(Procesamiento, NULL, PRIORIDAD_PROCESAMIENTO);
+    tareas[PRIORIDAD_VISUALIZACION] = EosTaskCreate(Visualizacion, NULL, PRIORIDAD_VISUALIZACION);
+    tareas[PRIORIDAD_CONSOLA] = EosTaskCreate(Consola, NULL, PRIORIDAD_CONSOLA);
+
+    EosStartScheduler();
+
+    return 0;
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
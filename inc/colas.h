@@ -41,6 +41,9 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   5 | 2026.10.16 | evolentini      | Reserva y adquisicion de elementos sin copia en colas   |
+ **|   4 | 2026.10.16 | evolentini      | Colas como objetos del nucleo con un unico servicio     |
+ **|   3 | 2026.10.16 | evolentini      | Tiempo maximo de espera en semaforos y colas            |
  **|   2 | 2021.08.15 | evolentini      | Compatibilidad con los handlers de interrupciones       |
  **|   1 | 2021.08.14 | evolentini      | Version inicial del archivo                             |
  **
@@ -86,29 +89,81 @@ eos_queue_t QueueCreate(void* data, uint32_t data_count, uint32_t data_size);
  * @brief Función interna del sistema sistema operativo para agregar un dato en una cola
  *
  * @remark Cuando esta función se llama desde la rutina de servicio de una interrupción
- * y la cola esta llena la función retorna \p false.
+ * y la cola esta llena la función retorna \p false. Cuando se llama desde una tarea y la cola
+ * esta llena la tarea se bloquea, el dato lo copia la tarea que libera un lugar y el resultado
+ * definitivo se le entrega al despertar.
  *
  * @param[in] queue     Puntero al descriptor de la cola de datos
  * @param[in] data      Puntero al bloque con el dato que se debe almacenar en la cola
+ * @param[in] timeout   Cantidad máxima de ticks que se espera un lugar libre en la cola
  * @return \p true      El dato se pudo almacenar en la cola sin errores
- * @return \p false     El el dato no se pudo almacenar en la cola porque estaba llena
- *                      y la función se llamó desde la rutina de servicio de una interrupción
+ * @return \p false     El el dato no se pudo almacenar en forma inmediata porque la cola
+ *                      estaba llena
  */
-bool QueueGive(eos_queue_t queue, void const* const data);
+bool QueueGive(eos_queue_t queue, void const* const data, uint32_t timeout);
 
 /**
  * @brief Función interna del sistema operativo para obtener un dato de una cola
  *
  * @remark Cuando esta función se llama desde la rutina de servicio de una interrupción
- * y la cola esta vacia la función retorna \p false.
+ * y la cola esta vacia la función retorna \p false. Cuando se llama desde una tarea y la cola
+ * esta vacia la tarea se bloquea, el dato lo copia la tarea que lo agrega y el resultado
+ * definitivo se le entrega al despertar.
  *
  * @param[in] queue     Puntero al descriptor de la cola de datos
  * @param[in] data      Puntero al bloque donde se debe almacenar el dato obtenido de la cola
+ * @param[in] timeout   Cantidad máxima de ticks que se espera un dato en la cola
  * @return \p true      El dato se pudo recuperar de la cola sin errores
- * @return \p false     El el dato no se pudo obtener de la cola porque estaba vacia
- *                      y la función se llamó desde la rutina de servicio de una interrupción
+ * @return \p false     El el dato no se pudo obtener en forma inmediata porque la cola
+ *                      estaba vacia
  */
-bool QueueTake(eos_queue_t queue, void* const data);
+bool QueueTake(eos_queue_t queue, void* const data, uint32_t timeout);
+
+/**
+ * @brief Función interna del sistema operativo para reservar un lugar libre en una cola
+ *
+ * @remark Solo se puede reservar un elemento por vez en cada cola. Los datos que se agregan
+ * mientras el elemento esta reservado se publican al confirmarlo para mantener el orden. Cuando
+ * se llama desde una tarea y la cola esta llena, o hay otro elemento reservado, la tarea se
+ * bloquea y la dirección del lugar reservado se le entrega al despertar.
+ *
+ * @param[in] queue     Puntero al descriptor de la cola de datos
+ * @param[in] timeout   Cantidad máxima de ticks que se espera un lugar libre en la cola
+ * @return              Dirección del lugar reservado dentro del bloque de datos de la cola o
+ *                      NULL si no se pudo reservar en forma inmediata
+ */
+void* QueueReserve(eos_queue_t queue, uint32_t timeout);
+
+/**
+ * @brief Función interna del sistema operativo para publicar un elemento reservado en una cola
+ *
+ * @param[in] queue     Puntero al descriptor de la cola de datos
+ * @param[in] element   Dirección del elemento obtenida con @ref QueueReserve
+ */
+void QueueCommit(eos_queue_t queue, void* element);
+
+/**
+ * @brief Función interna del sistema operativo para retirar un elemento sin copiarlo
+ *
+ * @remark Solo se puede adquirir un elemento por vez en cada cola. Su lugar y el de los datos
+ * que se retiran mientras tanto se liberan al llamar a @ref QueueRelease. Cuando se llama desde
+ * una tarea y la cola esta vacia, o hay otro elemento adquirido, la tarea se bloquea y la
+ * dirección del elemento adquirido se le entrega al despertar.
+ *
+ * @param[in] queue     Puntero al descriptor de la cola de datos
+ * @param[in] timeout   Cantidad máxima de ticks que se espera un dato en la cola
+ * @return              Dirección del elemento adquirido dentro del bloque de datos de la cola o
+ *                      NULL si no se pudo adquirir en forma inmediata
+ */
+void* QueueAcquire(eos_queue_t queue, uint32_t timeout);
+
+/**
+ * @brief Función interna del sistema operativo para liberar el lugar de un elemento adquirido
+ *
+ * @param[in] queue     Puntero al descriptor de la cola de datos
+ * @param[in] element   Dirección del elemento obtenida con @ref QueueAcquire
+ */
+void QueueRelease(eos_queue_t queue, void* element);
 
 /**
  * @brief Función interna del sistema operativo para destruir una cola de datos
@@ -41,6 +41,23 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|  22 | 2026.10.16 | evolentini      | Tamano de pila por tarea y pilas suministradas          |
+ **|  21 | 2026.10.16 | evolentini      | Uso maximo de pila y deteccion de desbordes             |
+ **|  20 | 2026.10.16 | evolentini      | Histogramas de latencias de activacion por interrupcion |
+ **|  19 | 2026.10.16 | evolentini      | Perfilado estadistico por muestreo en el SysTick        |
+ **|  18 | 2026.10.16 | evolentini      | Registro de eventos del nucleo en memoria               |
+ **|  17 | 2026.10.16 | evolentini      | Estadisticas de uso del procesador por tarea e IRQ      |
+ **|  16 | 2026.10.16 | evolentini      | Particiones de tiempo con un planificador cada una      |
+ **|  15 | 2026.10.16 | evolentini      | Presupuesto de ciclos de ejecucion de las tareas        |
+ **|  14 | 2026.10.16 | evolentini      | Planificador por vencimiento del plazo mas proximo      |
+ **|  13 | 2026.10.16 | evolentini      | Esperas en semaforos ordenadas por prioridad            |
+ **|  12 | 2026.10.16 | evolentini      | Mutex con herencia de prioridades                       |
+ **|  11 | 2026.10.16 | evolentini      | Grupos de bloques de memoria de tamaño fijo             |
+ **|  10 | 2026.10.16 | evolentini      | Flujos de datos con un productor y un consumidor        |
+ **|   9 | 2026.10.16 | evolentini      | Colas como objetos del nucleo con un unico servicio     |
+ **|   8 | 2026.10.16 | evolentini      | Modo sin ticks cuando solo se ejecuta la tarea inactiva |
+ **|   7 | 2026.10.16 | evolentini      | Reparto del procesador entre tareas de igual prioridad  |
+ **|   6 | 2026.10.16 | evolentini      | Se amplia la cantidad de prioridades hasta 32           |
  **|   5 | 2021.08.14 | evolentini      | Se incluyen las definiciones para de colas de datos     |
  **|   4 | 2021.08.09 | evolentini      | Se incluyen las definiciones para semaforos             |
  **|   3 | 2021.08.09 | evolentini      | Se separan las funciones publicas y privadas del SO     |
@@ -72,22 +89,34 @@ extern "C" {
 #error "La cantidad minima de tareas del sistema operativo es dos"
 #endif
 
+//! Cantidad mínima de bytes que se pueden asignar como pila a una tarea
+#define EOS_MIN_STACK_SIZE 128
+
 /**
  * @brief define la cantidad de bytes asignado como pila para cada tarea
  */
 #ifndef EOS_TASK_STACK_SIZE
 #define EOS_TASK_STACK_SIZE 256
-#elif (EOS_TASK_STACK_SIZE < 128)
+#elif (EOS_TASK_STACK_SIZE < EOS_MIN_STACK_SIZE)
 #error "La cantidad mínima de byte para asignar a una tarea es de 128 bytes"
 #endif
 
+/**
+ * @brief Define la cantidad de bytes reservados para las pilas de las tareas
+ */
+#ifndef EOS_STACK_POOL_SIZE
+#define EOS_STACK_POOL_SIZE (EOS_MAX_TASK_COUNT * EOS_TASK_STACK_SIZE)
+#elif (EOS_STACK_POOL_SIZE < 0)
+#error "La cantidad de bytes reservados para las pilas no puede ser negativa"
+#endif
+
 /**
  * @brief Define la máxima prioridad que se podrá asignar a una tarea
  */
 #ifndef EOS_MAX_PRIORITY
 #define EOS_MAX_PRIORITY 4
-#elif (EOS_MAX_PRIORITY < 0 || EOS_MAX_PRIORITY > 16)
-#error "La máxima prioridad de las tareas debe ser mayor o igual que 0 y menor que 16"
+#elif (EOS_MAX_PRIORITY < 1 || EOS_MAX_PRIORITY > 32)
+#error "La cantidad de prioridades de las tareas debe ser mayor que 0 y menor o igual que 32"
 #endif
 
 /**
@@ -106,8 +135,156 @@ extern "C" {
 #define EOS_MAX_QUEUES 4
 #elif (EOS_MAX_QUEUES < 0 || EOS_MAX_QUEUES > 64)
 #error "La cantidad máxima de colas debe ser mayor o igual que 0 y menor que 64"
-#elif (EOS_MAX_SEMAPHORES < 2 * EOS_MAX_QUEUES)
-#error "Cada cola de datos requiere dos semaforos"
+#endif
+
+/**
+ * @brief Define la máxima de flujos de datos que se podran crear en el sistema
+ */
+#ifndef EOS_MAX_STREAMS
+#define EOS_MAX_STREAMS 2
+#elif (EOS_MAX_STREAMS < 0 || EOS_MAX_STREAMS > 64)
+#error "La cantidad máxima de flujos debe ser mayor o igual que 0 y menor que 64"
+#endif
+
+/**
+ * @brief Define la máxima de grupos de bloques de memoria que se podran crear en el sistema
+ */
+#ifndef EOS_MAX_POOLS
+#define EOS_MAX_POOLS 2
+#elif (EOS_MAX_POOLS < 0 || EOS_MAX_POOLS > 64)
+#error "La cantidad máxima de grupos de bloques debe ser mayor o igual que 0 y menor que 64"
+#endif
+
+/**
+ * @brief Define la cantidad máxima de mutex que se podran crear en el sistema
+ */
+#ifndef EOS_MAX_MUTEXES
+#define EOS_MAX_MUTEXES 4
+#elif (EOS_MAX_MUTEXES < 0 || EOS_MAX_MUTEXES > 64)
+#error "La cantidad máxima de mutex debe ser mayor o igual que 0 y menor que 64"
+#endif
+
+/**
+ * @brief Define la cantidad de ticks que una tarea puede usar el procesador antes de cederlo
+ * a otra tarea lista con la misma prioridad, el valor cero deshabilita el reparto de tiempo
+ */
+#ifndef EOS_TIME_SLICE_TICKS
+#define EOS_TIME_SLICE_TICKS 0
+#endif
+
+/**
+ * @brief Habilita la supresión de los ticks del sistema cuando solo se ejecuta la tarea inactiva
+ */
+#ifndef EOS_TICKLESS_IDLE
+#define EOS_TICKLESS_IDLE 0
+#endif
+
+/**
+ * @brief Habilita el orden por prioridad de las tareas que esperan un semaforo
+ */
+#ifndef EOS_SEMAPHORE_PRIORITY_ORDER
+#define EOS_SEMAPHORE_PRIORITY_ORDER 0
+#endif
+
+/**
+ * @brief Habilita el planificador por vencimiento del plazo mas proximo
+ */
+#ifndef EOS_SCHEDULER_EDF
+#define EOS_SCHEDULER_EDF 0
+#endif
+
+/**
+ * @brief Habilita los presupuestos de ciclos de ejecución de las tareas
+ */
+#ifndef EOS_TASK_BUDGET
+#define EOS_TASK_BUDGET 0
+#endif
+
+/**
+ * @brief Habilita las estadisticas de uso del procesador de tareas e interrupciones
+ */
+#ifndef EOS_TASK_STATS
+#define EOS_TASK_STATS 0
+#endif
+
+/**
+ * @brief Habilita el registro de eventos del nucleo
+ */
+#ifndef EOS_TRACE
+#define EOS_TRACE 0
+#endif
+
+/**
+ * @brief Define la cantidad de eventos del registro
+ */
+#ifndef EOS_TRACE_SIZE
+#define EOS_TRACE_SIZE 256
+#elif (EOS_TRACE_SIZE < 1 || EOS_TRACE_SIZE > 32768 || (EOS_TRACE_SIZE & (EOS_TRACE_SIZE - 1)))
+#error "La cantidad de eventos del registro debe ser una potencia de 2 menor o igual que 32768"
+#endif
+
+/**
+ * @brief Habilita la medición del uso y la detección de desbordes de las pilas de las tareas
+ */
+#ifndef EOS_STACK_CHECK
+#define EOS_STACK_CHECK 0
+#endif
+
+/**
+ * @brief Habilita los histogramas de latencias de activación desde interrupciones
+ */
+#ifndef EOS_LATENCY
+#define EOS_LATENCY 0
+#endif
+
+/**
+ * @brief Define la cantidad de intervalos de los histogramas de latencias
+ */
+#ifndef EOS_LATENCY_BUCKETS
+#define EOS_LATENCY_BUCKETS 16
+#elif (EOS_LATENCY_BUCKETS < 1 || EOS_LATENCY_BUCKETS > 32)
+#error "La cantidad de intervalos de los histogramas debe ser mayor que 0 y menor o igual que 32"
+#endif
+
+/**
+ * @brief Habilita el perfilado estadistico por muestreo
+ */
+#ifndef EOS_PROFILER
+#define EOS_PROFILER 0
+#endif
+
+/**
+ * @brief Define la cantidad de ticks entre dos muestras del perfilado
+ */
+#ifndef EOS_PROFILER_PERIOD
+#define EOS_PROFILER_PERIOD 1
+#elif (EOS_PROFILER_PERIOD < 1)
+#error "La cantidad de ticks entre dos muestras debe ser mayor que 0"
+#endif
+
+/**
+ * @brief Define la cantidad de muestras del perfilado
+ */
+#ifndef EOS_PROFILER_SIZE
+#define EOS_PROFILER_SIZE 1024
+#elif (EOS_PROFILER_SIZE < 1 || EOS_PROFILER_SIZE > 32768                                         \
+    || (EOS_PROFILER_SIZE & (EOS_PROFILER_SIZE - 1)))
+#error "La cantidad de muestras debe ser una potencia de 2 menor o igual que 32768"
+#endif
+
+#if ((EOS_TRACE || EOS_PROFILER) && EOS_MAX_TASK_COUNT > 254)
+#error "Los registros identifican a las tareas con un byte, por lo que admiten hasta 254 tareas"
+#endif
+
+/**
+ * @brief Define la cantidad de particiones de tiempo del sistema
+ */
+#ifndef EOS_MAX_PARTITIONS
+#define EOS_MAX_PARTITIONS 1
+#elif (EOS_MAX_PARTITIONS < 1 || EOS_MAX_PARTITIONS > 8)
+#error "La cantidad de particiones debe ser mayor que 0 y menor o igual que 8"
+#elif (EOS_MAX_PARTITIONS > 1 && EOS_TICKLESS_IDLE)
+#error "El modo sin ticks no se puede utilizar con mas de una partición"
 #endif
 
 /* === Declaraciones de tipos de datos ========================================================= */
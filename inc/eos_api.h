@@ -41,6 +41,27 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|  27 | 2026.10.16 | evolentini      | Presupuesto agotado mientras se posee un mutex          |
+ **|  26 | 2026.10.16 | evolentini      | Error por techo de prioridad inferior a la tarea        |
+ **|  25 | 2026.10.16 | evolentini      | Tamano de pila por tarea y pilas suministradas          |
+ **|  24 | 2026.10.16 | evolentini      | Uso maximo de pila y deteccion de desbordes             |
+ **|  23 | 2026.10.16 | evolentini      | Histogramas de latencias de activacion por interrupcion |
+ **|  22 | 2026.10.16 | evolentini      | Estadisticas de uso del procesador por tarea e IRQ      |
+ **|  21 | 2026.10.16 | evolentini      | Particiones de tiempo con un planificador cada una      |
+ **|  20 | 2026.10.16 | evolentini      | Presupuesto de ciclos de ejecucion de las tareas        |
+ **|  19 | 2026.10.16 | evolentini      | Tareas periodicas y esperas hasta un tick absoluto      |
+ **|  18 | 2026.10.16 | evolentini      | Planificador por vencimiento del plazo mas proximo      |
+ **|  17 | 2026.10.16 | evolentini      | Umbral de desalojo de las tareas                        |
+ **|  16 | 2026.10.16 | evolentini      | Cambio de prioridad de las tareas en ejecucion          |
+ **|  15 | 2026.10.16 | evolentini      | Mutex con techo de prioridad inmediato                  |
+ **|  14 | 2026.10.16 | evolentini      | Mutex con herencia de prioridades                       |
+ **|  13 | 2026.10.16 | evolentini      | Grupos de bloques de memoria de tamaño fijo             |
+ **|  12 | 2026.10.16 | evolentini      | Reserva y adquisicion de elementos sin copia en colas   |
+ **|  11 | 2026.10.16 | evolentini      | Flujos de datos con un productor y un consumidor        |
+ **|  10 | 2026.10.16 | evolentini      | Colas como objetos del nucleo con un unico servicio     |
+ **|   9 | 2026.10.16 | evolentini      | Tiempo maximo de espera en semaforos y colas            |
+ **|   8 | 2026.10.16 | evolentini      | Modo sin ticks cuando solo se ejecuta la tarea inactiva |
+ **|   7 | 2026.10.16 | evolentini      | Reparto del procesador entre tareas de igual prioridad  |
  **|   6 | 2021.08.16 | evolentini      | Se mejora las notificaciones al usuario                 |
  **|   5 | 2021.08.16 | evolentini      | Se incluye una funcion para ceder el procesador         |
  **|   4 | 2021.08.15 | evolentini      | Se incluyen los handlers de interrupciones              |
@@ -64,6 +85,9 @@ extern "C" {
 
 /* === Definiciones y Macros =================================================================== */
 
+//! Tiempo de espera para las llamadas bloqueantes que no deben terminar por vencimiento
+#define EOS_WAIT_FOREVER UINT32_MAX
+
 /* === Declaraciones de tipos de datos ========================================================= */
 
 /**
@@ -74,6 +98,26 @@ typedef enum {
     EOS_SERVICE_YIELD,
     EOS_SERVICE_GIVE,
     EOS_SERVICE_TAKE,
+    EOS_SERVICE_QUEUE_GIVE,
+    EOS_SERVICE_QUEUE_TAKE,
+    EOS_SERVICE_QUEUE_RESERVE,
+    EOS_SERVICE_QUEUE_COMMIT,
+    EOS_SERVICE_QUEUE_ACQUIRE,
+    EOS_SERVICE_QUEUE_RELEASE,
+    EOS_SERVICE_STREAM_WAIT,
+    EOS_SERVICE_STREAM_WAKEUP,
+    EOS_SERVICE_POOL_ALLOCATE,
+    EOS_SERVICE_POOL_FREE,
+    EOS_SERVICE_MUTEX_LOCK,
+    EOS_SERVICE_MUTEX_UNLOCK,
+    EOS_SERVICE_TASK_PRIORITY,
+    EOS_SERVICE_TASK_THRESHOLD,
+    EOS_SERVICE_WAIT_UNTIL,
+    EOS_SERVICE_TASK_STATS,
+    EOS_SERVICE_HANDLER_STATS,
+    EOS_SERVICE_HANDLER_LATENCY,
+    //! Marca el final de la enumeración, no corresponde a ningún servicio
+    EOS_SERVICE_END,
 } eos_services_t;
 
 /**
@@ -92,6 +136,26 @@ typedef enum {
     EOS_ERRROR_DELAY_IN_HANDLER,
     //! Error al tratar de ceder el CPU en un handler de interrupcion
     EOS_ERRROR_YIELD_IN_HANDLER,
+    //! Error al crear un flujo por falta de descriptores o por parametros no validos
+    EOS_ERRROR_CREATING_STREAM,
+    //! Error al crear un grupo de bloques por falta de descriptores o por parametros no validos
+    EOS_ERRROR_CREATING_POOL,
+    //! Error al crear un mutex porque se alcanzó la cantidad maxima configurada
+    EOS_ERRROR_CREATING_MUTEX,
+    //! Error al tomar o liberar un mutex en un handler de interrupcion
+    EOS_ERRROR_MUTEX_IN_HANDLER,
+    //! Error al liberar un mutex que no pertenece a la tarea en ejecución
+    EOS_ERRROR_MUTEX_NOT_OWNER,
+    //! Error al asignar a una tarea una prioridad o un umbral mayor a la máxima configurada
+    EOS_ERRROR_TASK_PRIORITY,
+    //! Error al terminar el trabajo de una tarea periodica despues del vencimiento de su plazo
+    EOS_ERRROR_DEADLINE_MISS,
+    //! Error al asignar una partición no valida o despues de iniciar el planificador
+    EOS_ERRROR_PARTITION,
+    //! Error al detectar en un cambio de contexto que una tarea desbordó su pila
+    EOS_ERRROR_STACK_OVERFLOW,
+    //! Error al tomar un mutex con techo desde una tarea con una prioridad mayor que el techo
+    EOS_ERRROR_MUTEX_CEILING,
 } eos_error_t;
 
 /**
@@ -114,6 +178,43 @@ typedef struct eos_semaphore_s* eos_semaphore_t;
  */
 typedef struct eos_queue_s* eos_queue_t;
 
+/**
+ * @brief Tipo de datos con la referencia al descriptor de un flujo de datos
+ */
+typedef struct eos_stream_s* eos_stream_t;
+
+/**
+ * @brief Tipo de datos con la referencia al descriptor de un grupo de bloques de memoria
+ */
+typedef struct eos_pool_s* eos_pool_t;
+
+/**
+ * @brief Tipo de datos con la referencia al descriptor de un mutex
+ */
+typedef struct eos_mutex_s* eos_mutex_t;
+
+/**
+ * @brief Estructura con una ventana de tiempo del marco principal de las particiones
+ */
+typedef struct eos_window_s {
+    //! Partición cuyas tareas se ejecutan durante la ventana
+    uint8_t partition;
+    //! Duración de la ventana en ticks
+    uint32_t ticks;
+} const * eos_window_t;
+
+/**
+ * @brief Estructura con las estadisticas de uso del procesador de una tarea o una interrupción
+ */
+typedef struct eos_stats_s {
+    //! Cantidad de ciclos del procesador acumulados desde el inicio del planificador
+    uint64_t cycles;
+    //! Cantidad de veces que se asignó el procesador a la tarea o que se atendió la interrupción
+    uint32_t switches;
+    //! Porcentaje del tiempo transcurrido desde el inicio del planificador ocupado por los ciclos
+    uint8_t load;
+} * eos_stats_t;
+
 /* === Declaraciones de variables externas ===================================================== */
 
 /* === Declaraciones de funciones externas ===================================================== */
@@ -123,12 +224,98 @@ typedef struct eos_queue_s* eos_queue_t;
  *
  * @param[in]  entry_point  Puntero a la función que implementa la tarea
  * @param[in]  data         Puntero al bloque de datos para parametrizar la tarea
- * @param[in]  priority     Prioridad de la tarea que se desea crear
+ * @param[in]  priority     Prioridad de la tarea que se desea crear, menor que
+ *                          @ref EOS_MAX_PRIORITY
  *
  * @return                  Puntero al descriptor de la tarea creada
  */
 eos_task_t EosTaskCreate(eos_entry_point_t entry_point, void* data, uint8_t priority);
 
+/**
+ * @brief Función para crear una nueva tarea con un tamaño de pila o una pila propia
+ *
+ * @remark Sin un bloque de memoria la pila se reserva en el espacio para pilas del sistema
+ * operativo, cuyo tamaño se define con @ref EOS_STACK_POOL_SIZE. Un bloque suministrado debe
+ * estar alineado a 8 bytes y permanecer valido mientras exista la tarea.
+ *
+ * @code
+ * static uint8_t pila[256] __attribute__((aligned(8)));
+ * EosTaskCreateStack(Evento, NULL, 2, pila, sizeof(pila));
+ * EosTaskCreateStack(Consola, NULL, 1, NULL, 2048);
+ * @endcode
+ *
+ * @param[in]  entry_point  Puntero a la función que implementa la tarea
+ * @param[in]  data         Puntero al bloque de datos para parametrizar la tarea
+ * @param[in]  priority     Prioridad de la tarea que se desea crear, menor que
+ *                          @ref EOS_MAX_PRIORITY
+ * @param[in]  stack        Bloque de memoria para la pila o NULL para reservarla
+ * @param[in]  size         Cantidad de bytes de la pila, al menos @ref EOS_MIN_STACK_SIZE
+ *
+ * @return                  Puntero al descriptor de la tarea creada
+ */
+eos_task_t EosTaskCreateStack(
+    eos_entry_point_t entry_point, void* data, uint8_t priority, void* stack, uint16_t size);
+
+/**
+ * @brief Función para crear una tarea periodica
+ *
+ * @remark La función que implementa la tarea ejecuta un unico trabajo y retorna. El sistema
+ * operativo la llama una vez por periodo, registra la liberación y la finalización de cada
+ * trabajo y, si un trabajo termina despues de su plazo, lo cuenta y lo notifica con el error
+ * @ref EOS_ERRROR_DEADLINE_MISS. El primer trabajo se libera al crear la tarea, o al iniciar el
+ * planificador si se crea antes, aunque comience a ejecutarse mas tarde. Las liberaciones se
+ * calculan con @ref EosWaitUntil, por lo que un trabajo demorado no desplaza a los siguientes.
+ *
+ * @param[in]  entry_point  Puntero a la función que implementa un trabajo de la tarea
+ * @param[in]  data         Puntero al bloque de datos para parametrizar la tarea
+ * @param[in]  priority     Prioridad de la tarea, menor que @ref EOS_MAX_PRIORITY
+ * @param[in]  period       Cantidad de ticks entre las liberaciones de los trabajos
+ * @param[in]  deadline     Plazo en ticks de cada trabajo desde su liberación, cero para
+ *                          utilizar el periodo como plazo
+ *
+ * @return                  Puntero al descriptor de la tarea creada
+ */
+eos_task_t EosTaskCreatePeriodic(eos_entry_point_t entry_point, void* data, uint8_t priority,
+    uint32_t period, uint32_t deadline);
+
+/**
+ * @brief Función para obtener la cantidad de trabajos de una tarea periodica que terminaron
+ * despues del vencimiento de su plazo
+ *
+ * @param[in]  task         Puntero al descriptor de la tarea
+ * @return                  Cantidad de plazos incumplidos desde la creación de la tarea
+ */
+uint32_t EosTaskDeadlineMisses(eos_task_t task);
+
+/**
+ * @brief Función para asignar una tarea a una partición
+ *
+ * @remark Las tareas se crean en la partición cero y se deben asignar a otra partición antes de
+ * iniciar el planificador.
+ *
+ * @param[in]  task         Puntero al descriptor de la tarea
+ * @param[in]  partition    Partición de la tarea, menor que @ref EOS_MAX_PARTITIONS
+ */
+void EosTaskSetPartition(eos_task_t task, uint8_t partition);
+
+/**
+ * @brief Función para definir el marco principal de ventanas de tiempo de las particiones
+ *
+ * @remark Cada partición tiene su propio planificador por prioridades y sus tareas solo se
+ * ejecutan durante las ventanas asignadas a la partición. Las ventanas se recorren en orden y al
+ * terminar la ultima se repite el marco desde la primera. Sin un marco principal solo se ejecutan
+ * las tareas de la partición cero. La tabla debe permanecer valida mientras se ejecuta el sistema.
+ *
+ * @code
+ * static const struct eos_window_s MARCO[] = { { 0, 50 }, { 1, 30 }, { 0, 20 } };
+ * EosPartitionSchedule(MARCO, 3);
+ * @endcode
+ *
+ * @param[in]  windows      Vector con las ventanas del marco principal
+ * @param[in]  count        Cantidad de ventanas del marco principal
+ */
+void EosPartitionSchedule(eos_window_t windows, uint8_t count);
+
 /**
  * @brief Función para iniciar el planificador del sistema operativo
  */
@@ -137,15 +324,193 @@ void EosStartScheduler(void);
 /**
  * @brief Función para esperar una cantidad de tiempo sin utilizar el procesador
  *
+ * @remark Como el valor @ref EOS_WAIT_FOREVER indica una espera sin limite en las demas
+ * funciones, una demora con ese valor se limita a un tick menos para que la tarea despierte.
+ *
  * @param[in]  delay        Cantidad de tiempo en milisegundos que espera la tarea
  */
 void EosWaitDelay(uint32_t delay);
 
+/**
+ * @brief Función para esperar hasta un tick absoluto sin utilizar el procesador
+ *
+ * @remark La siguiente activación se calcula a partir de la anterior y no del momento de la
+ * llamada, por lo que un lazo periodico no acumula el tiempo de ejecución de cada ciclo. Si la
+ * activación ya ocurrió la función retorna sin esperar.
+ *
+ * @code
+ * uint32_t activacion = EosTickCount();
+ * while (1) {
+ *     EosWaitUntil(&activacion, PERIODO);
+ *     ...
+ * }
+ * @endcode
+ *
+ * @param[in,out] last_wake Tick de la activación anterior, se actualiza con la nueva activación
+ * @param[in]     period    Cantidad de ticks entre la activación anterior y la nueva
+ */
+void EosWaitUntil(uint32_t* last_wake, uint32_t period);
+
+/**
+ * @brief Función para obtener la cantidad de ticks transcurridos desde el inicio del planificador
+ *
+ * @return Cantidad de ticks del temporizador del sistema
+ */
+uint32_t EosTickCount(void);
+
 /**
  * @brief Función para ceder el procesador voluntariamente
  */
 void EosCpuYield(void);
 
+/**
+ * @brief Función para cambiar el tiempo que una tarea puede usar el procesador antes de cederlo
+ * a otra tarea lista de su misma prioridad
+ *
+ * @param[in]  task         Puntero al descriptor de la tarea
+ * @param[in]  ticks        Cantidad de ticks asignados a la tarea, cero deshabilita el reparto
+ */
+void EosTaskSetTimeSlice(eos_task_t task, uint32_t ticks);
+
+/**
+ * @brief Llamada al sistema operativo para cambiar la prioridad asignada a una tarea
+ *
+ * @remark Si la tarea posee mutex conserva la prioridad heredada o el techo que le corresponda
+ * cuando sea mayor que la nueva prioridad. Una tarea lista se mueve a la cola de su nueva
+ * prioridad, una tarea bloqueada se reordena en la lista de espera y, si la tarea supera la
+ * prioridad de la tarea en ejecución, la desaloja en forma inmediata.
+ *
+ * @param[in]  task         Puntero al descriptor de la tarea
+ * @param[in]  priority     Nueva prioridad asignada a la tarea, menor que @ref EOS_MAX_PRIORITY
+ */
+void EosTaskSetPriority(eos_task_t task, uint8_t priority);
+
+/**
+ * @brief Función para obtener la prioridad asignada a una tarea
+ *
+ * @remark La prioridad efectiva con la que se ejecuta la tarea puede ser mayor mientras posee
+ * mutex con herencia de prioridad o con techo de prioridad.
+ *
+ * @param[in]  task         Puntero al descriptor de la tarea
+ * @return                  Prioridad asignada a la tarea al crearla o con @ref EosTaskSetPriority
+ */
+uint8_t EosTaskGetPriority(eos_task_t task);
+
+#if EOS_STACK_CHECK
+/**
+ * @brief Función para obtener la máxima cantidad de bytes de pila que utilizó una tarea
+ *
+ * @remark Solo esta disponible si se habilita la opción @ref EOS_STACK_CHECK. La pila se pinta con
+ * un valor conocido al crear la tarea y se cuentan los bytes que ya no lo conservan, por lo que el
+ * resultado permite ajustar @ref EOS_TASK_STACK_SIZE con un margen de seguridad.
+ *
+ * @param[in]  task         Puntero al descriptor de la tarea o NULL para la tarea inactiva
+ * @return                  Cantidad máxima de bytes de pila utilizados por la tarea
+ */
+uint16_t EosTaskStackHighWater(eos_task_t task);
+#endif
+
+/**
+ * @brief Función para cambiar el plazo relativo de una tarea
+ *
+ * @remark Solo tiene efecto con el planificador por plazos habilitado con la opción
+ * @ref EOS_SCHEDULER_EDF. Cada vez que la tarea se libera al terminar una espera, el vencimiento
+ * de su plazo se calcula sumando el plazo relativo al tick actual y se ejecuta la tarea lista con
+ * el vencimiento mas proximo. Las tareas sin plazo se ejecutan despues de las tareas con plazo.
+ * El cambio también se aplica al trabajo en curso, cuyo vencimiento se cuenta desde su liberación.
+ *
+ * @param[in]  task         Puntero al descriptor de la tarea
+ * @param[in]  ticks        Plazo relativo en ticks, cero indica que la tarea no tiene plazo
+ */
+void EosTaskSetDeadline(eos_task_t task, uint32_t ticks);
+
+#if EOS_TASK_BUDGET
+/**
+ * @brief Función para limitar el tiempo de ejecución de una tarea en cada periodo
+ *
+ * @remark Solo esta disponible si se habilita la opción @ref EOS_TASK_BUDGET. Los ciclos que
+ * ejecuta la tarea se miden con el contador de ciclos del procesador y, cuando agota su
+ * presupuesto, la tarea se suspende hasta el inicio del siguiente periodo. El agotamiento se
+ * verifica en cada tick, por lo que la tarea puede excederse como máximo en la duración de un
+ * tick. Si la tarea agota su presupuesto mientras posee un mutex no se suspende, para no demorar
+ * a las tareas que lo esperan, sino que pierde su prioridad asignada y solo conserva la que hereda
+ * por los mutex que posee. La suspensión se aplica en el primer tick despues de liberarlos.
+ *
+ * @param[in]  task         Puntero al descriptor de la tarea
+ * @param[in]  cycles       Cantidad de ciclos que puede ejecutar la tarea en cada periodo, cero
+ *                          elimina el limite
+ * @param[in]  period       Cantidad de ticks entre las reposiciones del presupuesto
+ */
+void EosTaskSetBudget(eos_task_t task, uint32_t cycles, uint32_t period);
+#endif
+
+#if EOS_TASK_STATS
+/**
+ * @brief Función para obtener las estadisticas de uso del procesador de una tarea
+ *
+ * @remark Solo esta disponible si se habilita la opción @ref EOS_TASK_STATS. Los ciclos que se
+ * ejecutan en los handlers de interrupciones no se cargan a la tarea interrumpida. Las
+ * estadisticas de la tarea inactiva informan todo el tiempo no ocupado por otras tareas o por
+ * interrupciones, incluyendo el tiempo en el que el procesador estuvo dormido.
+ *
+ * @code
+ * struct eos_stats_s inactiva[1];
+ * EosTaskGetStats(NULL, inactiva);
+ * @endcode
+ *
+ * @param[in]  task         Puntero al descriptor de la tarea o NULL para la tarea inactiva
+ * @param[out] stats        Estructura en la que se devuelven las estadisticas
+ */
+void EosTaskGetStats(eos_task_t task, eos_stats_t stats);
+
+/**
+ * @brief Función para obtener las estadisticas de uso del procesador de una interrupción
+ *
+ * @remark Solo esta disponible si se habilita la opción @ref EOS_TASK_STATS. Solo se miden las
+ * interrupciones con un handler instalado con @ref EosHandlerInstall.
+ *
+ * @param[in]  service      Numero de interupcion de la que se desean las estadisticas
+ * @param[out] stats        Estructura en la que se devuelven las estadisticas
+ */
+void EosHandlerGetStats(uint8_t service, eos_stats_t stats);
+#endif
+
+#if EOS_LATENCY
+/**
+ * @brief Función para obtener el histograma de latencias de activación de una interrupción
+ *
+ * @remark Solo esta disponible si se habilita la opción @ref EOS_LATENCY. Se mide en ciclos del
+ * procesador el tiempo entre la entrada al handler de la interrupción y el cambio de contexto a
+ * cada tarea que el handler despierta. El elemento n del histograma cuenta las latencias entre
+ * 2^n y 2^(n+1) - 1 ciclos y el ultimo elemento acumula tambien todas las latencias mayores.
+ *
+ * @code
+ * uint32_t histograma[EOS_LATENCY_BUCKETS];
+ * EosHandlerGetLatency(PIN_INT0_IRQn, histograma, true);
+ * @endcode
+ *
+ * @param[in]  service      Numero de interupcion de la que se desea el histograma
+ * @param[out] histogram    Vector de @ref EOS_LATENCY_BUCKETS elementos o NULL para solo borrarlo
+ * @param[in]  reset        Indica si el histograma se borra despues de leerlo
+ */
+void EosHandlerGetLatency(uint8_t service, uint32_t* histogram, bool reset);
+#endif
+
+/**
+ * @brief Llamada al sistema operativo para cambiar el umbral de desalojo de una tarea
+ *
+ * @remark Mientras la tarea se ejecuta solo la pueden desalojar las tareas con una prioridad mayor
+ * que el umbral, por lo que las tareas con prioridades hasta el umbral se comportan como un grupo
+ * no desalojable y se reducen los cambios de contexto. Tampoco se reparte el procesador con las
+ * tareas de igual prioridad, ni por tiempo ni al ceder el procesador. Un umbral menor o igual que
+ * la prioridad de la tarea, como el valor cero asignado al crearla, no tiene efecto.
+ *
+ * @param[in]  task         Puntero al descriptor de la tarea
+ * @param[in]  threshold    Prioridad que debe superar una tarea lista para desalojarla, menor que
+ *                          @ref EOS_MAX_PRIORITY
+ */
+void EosTaskSetPreemptionThreshold(eos_task_t task, uint8_t threshold);
+
 /**
  * @brief Función del sistema operativo para crear un semaforo contador
  *
@@ -168,6 +533,19 @@ void EosSemaphoreGive(eos_semaphore_t semaphore);
  */
 bool EosSemaphoreTake(eos_semaphore_t semaphore);
 
+/**
+ * @brief  Llamada al sistema operativo para tomar un semaforo con un tiempo máximo de espera
+ *
+ * @remark Cuando se llama desde un handler de interrupción no se espera y el tiempo se ignora.
+ *
+ * @param semaphore Puntero al descriptor del semaforo
+ * @param timeout   Cantidad máxima de ticks de espera, cero no espera y @ref EOS_WAIT_FOREVER
+ *                  espera sin limite
+ * @return \p true  El semaforo se tomó correctamente
+ * @return \p false El semaforo no se pudo tomar antes del vencimiento del tiempo de espera
+ */
+bool EosSemaphoreTakeTimeout(eos_semaphore_t semaphore, uint32_t timeout);
+
 /**
  * @brief Función del sistema operativo para crear un una cola de datos
  *
@@ -185,6 +563,19 @@ eos_queue_t EosQueueCreate(void* data, uint32_t count, uint32_t size);
  */
 bool EosQueueGive(eos_queue_t queue, void* data);
 
+/**
+ * @brief Llamada al sistema operativo para agregar un dato en una cola con un tiempo máximo
+ * de espera
+ *
+ * @param queue     Puntero al descriptor de la cola de datos
+ * @param data      Puntero al bloque con el dato que se debe almacenar en la cola
+ * @param timeout   Cantidad máxima de ticks de espera, cero no espera y @ref EOS_WAIT_FOREVER
+ *                  espera sin limite
+ * @return \p true  El dato se almacenó en la cola
+ * @return \p false La cola siguió llena hasta el vencimiento del tiempo de espera
+ */
+bool EosQueueGiveTimeout(eos_queue_t queue, void* data, uint32_t timeout);
+
 /**
  * @brief Llamada al sistema operativo para obtener un dato de una cola
  *
@@ -192,6 +583,241 @@ bool EosQueueGive(eos_queue_t queue, void* data);
  */
 bool EosQueueTake(eos_queue_t queue, void* data);
 
+/**
+ * @brief Llamada al sistema operativo para obtener un dato de una cola con un tiempo máximo
+ * de espera
+ *
+ * @param queue     Puntero al descriptor de la cola de datos
+ * @param data      Puntero al bloque donde se debe almacenar el dato obtenido de la cola
+ * @param timeout   Cantidad máxima de ticks de espera, cero no espera y @ref EOS_WAIT_FOREVER
+ *                  espera sin limite
+ * @return \p true  El dato se obtuvo de la cola
+ * @return \p false La cola siguió vacia hasta el vencimiento del tiempo de espera
+ */
+bool EosQueueTakeTimeout(eos_queue_t queue, void* data, uint32_t timeout);
+
+/**
+ * @brief Llamada al sistema operativo para reservar un lugar en una cola y construir el dato
+ * directamente en el bloque de almacenamiento de la cola
+ *
+ * @remark Solo se puede reservar un elemento por vez en cada cola y el dato no es visible para
+ * el consumidor hasta llamar a @ref EosQueueCommit. Si la cola esta llena o hay otro elemento
+ * reservado la tarea espera, y si varias tareas esperan cada una recibe su reserva despues de que
+ * se confirme la anterior.
+ *
+ * @param queue Puntero al descriptor de la cola de datos
+ * @return      Dirección del lugar reservado
+ */
+void* EosQueueReserve(eos_queue_t queue);
+
+/**
+ * @brief Llamada al sistema operativo para reservar un lugar en una cola con un tiempo máximo
+ * de espera
+ *
+ * @param queue     Puntero al descriptor de la cola de datos
+ * @param timeout   Cantidad máxima de ticks de espera, cero no espera y @ref EOS_WAIT_FOREVER
+ *                  espera sin limite
+ * @return          Dirección del lugar reservado o NULL si la cola siguió llena, o con otro
+ *                  elemento reservado, hasta el vencimiento del tiempo de espera
+ */
+void* EosQueueReserveTimeout(eos_queue_t queue, uint32_t timeout);
+
+/**
+ * @brief Llamada al sistema operativo para publicar en una cola el elemento reservado
+ *
+ * @param queue     Puntero al descriptor de la cola de datos
+ * @param element   Dirección del elemento obtenida con @ref EosQueueReserve
+ */
+void EosQueueCommit(eos_queue_t queue, void* element);
+
+/**
+ * @brief Llamada al sistema operativo para obtener un dato de una cola y usarlo directamente
+ * desde el bloque de almacenamiento de la cola
+ *
+ * @remark Solo se puede adquirir un elemento por vez en cada cola y su lugar no se reutiliza
+ * hasta llamar a @ref EosQueueRelease. Si la cola esta vacia o hay otro elemento adquirido la
+ * tarea espera, y si varias tareas esperan cada una recibe su elemento despues de que se libere
+ * el anterior.
+ *
+ * @param queue Puntero al descriptor de la cola de datos
+ * @return      Dirección del elemento adquirido
+ */
+void* EosQueueAcquire(eos_queue_t queue);
+
+/**
+ * @brief Llamada al sistema operativo para adquirir un dato de una cola con un tiempo máximo
+ * de espera
+ *
+ * @param queue     Puntero al descriptor de la cola de datos
+ * @param timeout   Cantidad máxima de ticks de espera, cero no espera y @ref EOS_WAIT_FOREVER
+ *                  espera sin limite
+ * @return          Dirección del elemento adquirido o NULL si la cola siguió vacia, o con otro
+ *                  elemento adquirido, hasta el vencimiento del tiempo de espera
+ */
+void* EosQueueAcquireTimeout(eos_queue_t queue, uint32_t timeout);
+
+/**
+ * @brief Llamada al sistema operativo para liberar el lugar del elemento adquirido en una cola
+ *
+ * @param queue     Puntero al descriptor de la cola de datos
+ * @param element   Dirección del elemento obtenida con @ref EosQueueAcquire
+ */
+void EosQueueRelease(eos_queue_t queue, void* element);
+
+/**
+ * @brief Función del sistema operativo para crear un flujo de datos entre un unico productor y
+ * un unico consumidor
+ *
+ * @remark A diferencia de las colas, agregar y retirar datos no requiere llamar al sistema
+ * operativo salvo para despertar al consumidor cuando el flujo deja de estar vacio, por lo que
+ * es adecuado para enviar datos desde interrupciones de alta frecuencia a una tarea.
+ *
+ * @param data  Puntero al bloque de datos alineado a palabra donde se almacenaran los elementos
+ * @param count Cantidad de elementos que se pueden almacenar, debe ser una potencia de dos
+ * @param size  Tamaño en bytes de cada elemento almacenado, debe ser multiplo de cuatro
+ * @return Puntero al descriptor del flujo de datos creado
+ */
+eos_stream_t EosStreamCreate(void* data, uint32_t count, uint32_t size);
+
+/**
+ * @brief Función del sistema operativo para agregar un dato en un flujo sin esperar
+ *
+ * @remark Solo el productor del flujo puede llamar a esta función, que puede ser una tarea
+ * o la rutina de servicio de una interrupción.
+ *
+ * @param stream    Puntero al descriptor del flujo de datos
+ * @param data      Puntero al bloque con el dato que se debe almacenar en el flujo
+ * @return \p true  El dato se almacenó en el flujo
+ * @return \p false El dato se descartó porque el flujo estaba lleno
+ */
+bool EosStreamWrite(eos_stream_t stream, void const* data);
+
+/**
+ * @brief Llamada al sistema operativo para obtener un dato de un flujo
+ *
+ * @remark Solo la tarea consumidora del flujo puede llamar a esta función.
+ *
+ * @param stream    Puntero al descriptor del flujo de datos
+ * @param data      Puntero al bloque donde se debe almacenar el dato obtenido del flujo
+ * @return \p true  El dato se obtuvo del flujo
+ * @return \p false El flujo esta vacio y la función se llamó desde una interrupción
+ */
+bool EosStreamRead(eos_stream_t stream, void* data);
+
+/**
+ * @brief Llamada al sistema operativo para obtener un dato de un flujo con un tiempo máximo
+ * de espera
+ *
+ * @param stream    Puntero al descriptor del flujo de datos
+ * @param data      Puntero al bloque donde se debe almacenar el dato obtenido del flujo
+ * @param timeout   Cantidad máxima de ticks de espera, cero no espera y @ref EOS_WAIT_FOREVER
+ *                  espera sin limite
+ * @return \p true  El dato se obtuvo del flujo
+ * @return \p false El flujo siguió vacio hasta el vencimiento del tiempo de espera
+ */
+bool EosStreamReadTimeout(eos_stream_t stream, void* data, uint32_t timeout);
+
+/**
+ * @brief Función del sistema operativo para crear un grupo de bloques de memoria de tamaño fijo
+ *
+ * @remark Asignar y liberar bloques demora siempre el mismo tiempo, por lo que se pueden enviar
+ * punteros a los bloques por una cola en lugar de copiar los datos.
+ *
+ * @param storage   Puntero al bloque de memoria alineado a palabra que se divide en bloques,
+ *                  debe tener al menos size * count bytes
+ * @param size      Tamaño en bytes de cada bloque, debe ser multiplo de cuatro
+ * @param count     Cantidad de bloques del grupo
+ * @return Puntero al descriptor del grupo de bloques creado
+ */
+eos_pool_t EosPoolCreate(void* storage, uint32_t size, uint32_t count);
+
+/**
+ * @brief Llamada al sistema operativo para obtener un bloque de memoria
+ *
+ * @remark Cuando se llama desde la rutina de servicio de una interrupción no se espera y la
+ * función devuelve NULL si no hay bloques libres.
+ *
+ * @param pool  Puntero al descriptor del grupo de bloques de memoria
+ * @return      Dirección del bloque asignado
+ */
+void* EosPoolAllocate(eos_pool_t pool);
+
+/**
+ * @brief Llamada al sistema operativo para obtener un bloque de memoria con un tiempo máximo
+ * de espera
+ *
+ * @param pool      Puntero al descriptor del grupo de bloques de memoria
+ * @param timeout   Cantidad máxima de ticks de espera, cero no espera y @ref EOS_WAIT_FOREVER
+ *                  espera sin limite
+ * @return          Dirección del bloque asignado o NULL si no hubo bloques libres hasta el
+ *                  vencimiento del tiempo de espera
+ */
+void* EosPoolAllocateTimeout(eos_pool_t pool, uint32_t timeout);
+
+/**
+ * @brief Llamada al sistema operativo para devolver un bloque de memoria al grupo
+ *
+ * @param pool  Puntero al descriptor del grupo de bloques de memoria
+ * @param block Dirección del bloque obtenida con @ref EosPoolAllocate
+ */
+void EosPoolFree(eos_pool_t pool, void* block);
+
+/**
+ * @brief Función del sistema operativo para crear un mutex con herencia de prioridades
+ *
+ * @remark Mientras una tarea espera el mutex, la tarea que lo posee se ejecuta al menos con la
+ * prioridad de la tarea que espera, por lo que el tiempo de bloqueo queda acotado por la duración
+ * de la sección critica.
+ *
+ * @return Puntero al descriptor del mutex creado
+ */
+eos_mutex_t EosMutexCreate(void);
+
+/**
+ * @brief Función del sistema operativo para crear un mutex con techo de prioridad inmediato
+ *
+ * @remark La tarea que toma el mutex se eleva en forma inmediata hasta el techo, por lo que ninguna
+ * otra tarea que use el mutex puede desalojarla durante la sección critica. El techo debe ser mayor
+ * o igual que la prioridad de todas las tareas que usan el mutex, en caso contrario al tomarlo se
+ * informa el error @ref EOS_ERRROR_MUTEX_CEILING. Si las tareas no se bloquean mientras lo poseen,
+ * los mutex que comparten techos no pueden producir un interbloqueo. Como las tareas de igual
+ * prioridad se alternan en cada llamada al sistema, un techo mayor que todas esas prioridades evita
+ * tambien los cambios de contexto dentro de la sección critica.
+ *
+ * @param ceiling   Prioridad a la que se eleva la tarea que posee el mutex
+ * @return          Puntero al descriptor del mutex creado
+ */
+eos_mutex_t EosMutexCreateCeiling(uint8_t ceiling);
+
+/**
+ * @brief Llamada al sistema operativo para tomar un mutex
+ *
+ * @remark La tarea que posee el mutex lo puede volver a tomar y lo debe liberar la misma cantidad
+ * de veces. No se puede llamar desde la rutina de servicio de una interrupción.
+ *
+ * @param mutex Puntero al descriptor del mutex
+ * @return \p true  El mutex se tomó correctamente
+ */
+bool EosMutexLock(eos_mutex_t mutex);
+
+/**
+ * @brief Llamada al sistema operativo para tomar un mutex con un tiempo máximo de espera
+ *
+ * @param mutex     Puntero al descriptor del mutex
+ * @param timeout   Cantidad máxima de ticks de espera, cero no espera y @ref EOS_WAIT_FOREVER
+ *                  espera sin limite
+ * @return \p true  El mutex se tomó correctamente
+ * @return \p false El mutex no se liberó antes del vencimiento del tiempo de espera
+ */
+bool EosMutexLockTimeout(eos_mutex_t mutex, uint32_t timeout);
+
+/**
+ * @brief Llamada al sistema operativo para liberar un mutex
+ *
+ * @param mutex Puntero al descriptor del mutex
+ */
+void EosMutexUnlock(eos_mutex_t mutex);
+
 /**
  * @brief Función interna para instalar un handler de interrupciones
  *
@@ -41,6 +41,22 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|  20 | 2026.10.16 | evolentini      | Tamano de pila por tarea y pilas suministradas          |
+ **|  19 | 2026.10.16 | evolentini      | Uso maximo de pila y deteccion de desbordes             |
+ **|  18 | 2026.10.16 | evolentini      | Histogramas de latencias de activacion por interrupcion |
+ **|  17 | 2026.10.16 | evolentini      | Perfilado estadistico por muestreo en el SysTick        |
+ **|  16 | 2026.10.16 | evolentini      | Registro de eventos del nucleo en memoria               |
+ **|  15 | 2026.10.16 | evolentini      | Estadisticas de uso del procesador por tarea e IRQ      |
+ **|  14 | 2026.10.16 | evolentini      | Particiones de tiempo con un planificador cada una      |
+ **|  13 | 2026.10.16 | evolentini      | Presupuesto de ciclos de ejecucion de las tareas        |
+ **|  12 | 2026.10.16 | evolentini      | Planificador por vencimiento del plazo mas proximo      |
+ **|  11 | 2026.10.16 | evolentini      | Esperas en semaforos ordenadas por prioridad            |
+ **|  10 | 2026.10.16 | evolentini      | Mutex con herencia de prioridades                       |
+ **|   9 | 2026.10.16 | evolentini      | Grupos de bloques de memoria de tamaño fijo             |
+ **|   8 | 2026.10.16 | evolentini      | Flujos de datos con un productor y un consumidor        |
+ **|   7 | 2026.10.16 | evolentini      | Modo sin ticks cuando solo se ejecuta la tarea inactiva |
+ **|   6 | 2026.10.16 | evolentini      | Reparto del procesador entre tareas de igual prioridad  |
+ **|   5 | 2026.10.16 | evolentini      | Se permite redefinir la configuracion al compilar       |
  **|   4 | 2021.08.14 | evolentini      | Se incluyen las definiciones para de colas de datos     |
  **|   3 | 2021.08.09 | evolentini      | Se incluyen las definiciones para semaforos             |
  **|   2 | 2021.08.08 | evolentini      | Se agrega la cantidad de pioridades del sistema         |
@@ -61,27 +77,183 @@ extern "C" {
 /**
  * @brief Define la cantidad máxima de tareas que se podrán crear en el sistema operativo
  */
+#ifndef EOS_MAX_TASK_COUNT
 #define EOS_MAX_TASK_COUNT 8
+#endif
 
 /**
  * @brief Cantidad de bytes asignado como pila para cada tarea
  */
+#ifndef EOS_TASK_STACK_SIZE
 #define EOS_TASK_STACK_SIZE 2048
+#endif
+
+/**
+ * @brief Cantidad de bytes reservados para las pilas de las tareas que no suministran un bloque
+ * de memoria propio con @ref EosTaskCreateStack. La pila de la tarea inactiva se reserva aparte.
+ */
+#ifndef EOS_STACK_POOL_SIZE
+#define EOS_STACK_POOL_SIZE (EOS_MAX_TASK_COUNT * EOS_TASK_STACK_SIZE)
+#endif
 
 /**
  * @brief Define la máxima prioridad que se podrá asignar a una tarea
  */
+#ifndef EOS_MAX_PRIORITY
 #define EOS_MAX_PRIORITY 8
+#endif
 
 /**
  * @brief Define la cantidad máxima semaforos que se podran crear en el sistema
  */
+#ifndef EOS_MAX_SEMAPHORES
 #define EOS_MAX_SEMAPHORES 16
+#endif
 
 /**
  * @brief Define la máxima de colas de datos que se podran crear en el sistema
  */
+#ifndef EOS_MAX_QUEUES
 #define EOS_MAX_QUEUES 4
+#endif
+
+/**
+ * @brief Define la máxima de flujos de datos que se podran crear en el sistema
+ */
+#ifndef EOS_MAX_STREAMS
+#define EOS_MAX_STREAMS 2
+#endif
+
+/**
+ * @brief Define la máxima de grupos de bloques de memoria que se podran crear en el sistema
+ */
+#ifndef EOS_MAX_POOLS
+#define EOS_MAX_POOLS 2
+#endif
+
+/**
+ * @brief Define la cantidad máxima de mutex que se podran crear en el sistema
+ */
+#ifndef EOS_MAX_MUTEXES
+#define EOS_MAX_MUTEXES 4
+#endif
+
+/**
+ * @brief Define la cantidad de ticks asignados por defecto a cada tarea para compartir el
+ * procesador con otras tareas de la misma prioridad, el valor cero deshabilita el reparto
+ */
+#ifndef EOS_TIME_SLICE_TICKS
+#define EOS_TIME_SLICE_TICKS 0
+#endif
+
+/**
+ * @brief Habilita la supresión de los ticks del sistema cuando solo se ejecuta la tarea inactiva,
+ * el temporizador se programa para la primera espera que vence y la cuenta se corrige al despertar
+ */
+#ifndef EOS_TICKLESS_IDLE
+#define EOS_TICKLESS_IDLE 0
+#endif
+
+/**
+ * @brief Habilita el orden por prioridad de las tareas que esperan un semaforo, con el mismo
+ * orden de llegada entre las tareas de igual prioridad
+ */
+#ifndef EOS_SEMAPHORE_PRIORITY_ORDER
+#define EOS_SEMAPHORE_PRIORITY_ORDER 0
+#endif
+
+/**
+ * @brief Reemplaza el planificador por prioridades fijas por un planificador que ejecuta la tarea
+ * lista cuyo plazo vence primero, las tareas declaran su plazo con @ref EosTaskSetDeadline
+ */
+#ifndef EOS_SCHEDULER_EDF
+#define EOS_SCHEDULER_EDF 0
+#endif
+
+/**
+ * @brief Habilita la medición de los ciclos que ejecuta cada tarea y la suspensión de las tareas
+ * que agotan el presupuesto asignado con @ref EosTaskSetBudget hasta su reposición
+ */
+#ifndef EOS_TASK_BUDGET
+#define EOS_TASK_BUDGET 0
+#endif
+
+/**
+ * @brief Habilita la medición con el contador de ciclos del procesador del tiempo que ocupa cada
+ * tarea y cada interrupción, que se consulta con @ref EosTaskGetStats y @ref EosHandlerGetStats
+ */
+#ifndef EOS_TASK_STATS
+#define EOS_TASK_STATS 0
+#endif
+
+/**
+ * @brief Habilita el registro en memoria de los cambios de contexto, los servicios del sistema, las
+ * operaciones sobre semaforos y colas y la atención de interrupciones
+ */
+#ifndef EOS_TRACE
+#define EOS_TRACE 0
+#endif
+
+/**
+ * @brief Define la cantidad de eventos que se conservan en el registro, debe ser una potencia de 2
+ */
+#ifndef EOS_TRACE_SIZE
+#define EOS_TRACE_SIZE 256
+#endif
+
+/**
+ * @brief Habilita el pintado de las pilas de las tareas para medir su uso con
+ * @ref EosTaskStackHighWater y la detección de desbordes en cada cambio de contexto
+ */
+#ifndef EOS_STACK_CHECK
+#define EOS_STACK_CHECK 0
+#endif
+
+/**
+ * @brief Habilita la medición de los ciclos entre la entrada a una interrupción y la ejecución de
+ * las tareas que despierta, que se consultan con @ref EosHandlerGetLatency
+ */
+#ifndef EOS_LATENCY
+#define EOS_LATENCY 0
+#endif
+
+/**
+ * @brief Define la cantidad de intervalos de potencias de 2 de los histogramas de latencias
+ */
+#ifndef EOS_LATENCY_BUCKETS
+#define EOS_LATENCY_BUCKETS 16
+#endif
+
+/**
+ * @brief Habilita el perfilado estadistico que muestrea el contador de programa de la tarea
+ * interrumpida por el temporizador del sistema. Con @ref EOS_TICKLESS_IDLE no se toman muestras
+ * mientras el procesador duerme en la tarea inactiva.
+ */
+#ifndef EOS_PROFILER
+#define EOS_PROFILER 0
+#endif
+
+/**
+ * @brief Define la cantidad de interrupciones del temporizador del sistema entre dos muestras
+ */
+#ifndef EOS_PROFILER_PERIOD
+#define EOS_PROFILER_PERIOD 1
+#endif
+
+/**
+ * @brief Define la cantidad de muestras que se conservan, debe ser una potencia de 2
+ */
+#ifndef EOS_PROFILER_SIZE
+#define EOS_PROFILER_SIZE 1024
+#endif
+
+/**
+ * @brief Define la cantidad de particiones, cada una con su propio planificador, que se ejecutan
+ * en las ventanas de tiempo definidas con @ref EosPartitionSchedule
+ */
+#ifndef EOS_MAX_PARTITIONS
+#define EOS_MAX_PARTITIONS 1
+#endif
 
 /* === Declaraciones de tipos de datos ========================================================= */
 
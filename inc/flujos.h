@@ -0,0 +1,156 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef FLUJOS_H
+#define FLUJOS_H
+
+/** @file flujos.h
+ ** @brief Declaraciones privadas del sistema operativo para la gestion de flujos de datos
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+
+#include "eos.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definiciones y Macros =================================================================== */
+
+/* === Declaraciones de tipos de datos ========================================================= */
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/**
+ * @brief Función interna del sistema operativo para consultar la cantidad de flujos disponibles
+ *
+ * @return Cantidad de flujos de datos disponibles para ser creados
+ */
+uint32_t StreamAvaiables(void);
+
+/**
+ * @brief Función interna del sistema operativo para crear un flujo de datos
+ *
+ * @param[in]   data        Puntero al bloque de datos alineado a palabra donde se almacenaran
+ *                          los elementos
+ * @param[in]   data_count  Cantidad de elementos que se pueden almacenar, debe ser potencia de dos
+ * @param[in]   data_size   Tamaño en bytes de cada elemento, debe ser multiplo de cuatro
+ * @return                  Puntero al descriptor del flujo de datos creado o NULL si no hay
+ *                          descriptores disponibles o los parametros no son validos
+ */
+eos_stream_t StreamCreate(void* data, uint32_t data_count, uint32_t data_size);
+
+/**
+ * @brief Función interna del sistema operativo para agregar un dato en un flujo
+ *
+ * @remark Solo modifica el indice de ingreso, por lo que se puede ejecutar sin llamar al
+ * sistema operativo mientras exista un unico productor. No despierta al consumidor.
+ *
+ * @param[in] stream    Puntero al descriptor del flujo de datos
+ * @param[in] data      Puntero al bloque con el dato que se debe almacenar en el flujo
+ * @return \p true      El dato se almacenó en el flujo
+ * @return \p false     El dato se descartó porque el flujo estaba lleno
+ */
+bool StreamWrite(eos_stream_t stream, void const* const data);
+
+/**
+ * @brief Función interna del sistema operativo para obtener un dato de un flujo
+ *
+ * @remark Solo modifica el indice de salida, por lo que se puede ejecutar sin llamar al
+ * sistema operativo mientras exista un unico consumidor. No bloquea al consumidor.
+ *
+ * @param[in] stream    Puntero al descriptor del flujo de datos
+ * @param[in] data      Puntero al bloque donde se debe almacenar el dato obtenido del flujo
+ * @return \p true      El dato se obtuvo del flujo
+ * @return \p false     El flujo estaba vacio
+ */
+bool StreamRead(eos_stream_t stream, void* const data);
+
+/**
+ * @brief Función interna del sistema operativo para consultar si el consumidor esta bloqueado
+ *
+ * @param[in] stream    Puntero al descriptor del flujo de datos
+ * @return \p true      El consumidor espera con el flujo vacio y se lo debe despertar
+ * @return \p false     El consumidor no esta bloqueado en el flujo
+ */
+bool StreamWaiting(eos_stream_t stream);
+
+/**
+ * @brief Función interna del sistema operativo para bloquear al consumidor hasta que haya datos
+ *
+ * @remark Se ejecuta en el servicio del sistema operativo, por lo que el productor no puede
+ * agregar un dato entre la verificación del flujo vacio y el bloqueo de la tarea.
+ *
+ * @param[in] stream    Puntero al descriptor del flujo de datos
+ * @param[in] timeout   Cantidad máxima de ticks que se espera un dato en el flujo
+ * @return \p true      El flujo tiene datos disponibles
+ * @return \p false     El flujo estaba vacio, el resultado definitivo se entrega al despertar
+ */
+bool StreamWait(eos_stream_t stream, uint32_t timeout);
+
+/**
+ * @brief Función interna del sistema operativo para despertar al consumidor de un flujo
+ *
+ * @param[in] stream    Puntero al descriptor del flujo de datos
+ */
+void StreamWakeup(eos_stream_t stream);
+
+/**
+ * @brief Función interna del sistema operativo para destruir un flujo de datos
+ *
+ * @param stream Puntero al descriptor del flujo de datos
+ */
+void StreamDestroy(eos_stream_t stream);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif /* FLUJOS_H */
@@ -41,6 +41,8 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   3 | 2026.10.16 | evolentini      | Histogramas de latencias de activacion por interrupcion |
+ **|   2 | 2026.10.16 | evolentini      | Estadisticas de uso del procesador por tarea e IRQ      |
  **|   1 | 2021.08.15 | evolentini      | Version inicial del archivo                             |
  **
  ** @addtogroup eos
@@ -89,6 +91,45 @@ void HandlerInstall(uint8_t service, uint8_t priority, eos_entry_point_t entry_p
  */
 void HandlerRemove(uint8_t service);
 
+#if EOS_TASK_STATS
+/**
+ * @brief Función interna para obtener las estadisticas de uso del procesador de una interrupción
+ *
+ * @param[in] service       Numero de interupcion de la que se desean las estadisticas
+ * @param[out] stats        Estructura en la que se devuelven las estadisticas
+ */
+void HandlerGetStats(uint8_t service, eos_stats_t stats);
+#endif
+
+#if EOS_LATENCY
+/**
+ * @brief Función interna para obtener la interrupción en curso que despierta a una tarea
+ *
+ * @param[out] service      Numero de la interrupción anidada mas reciente
+ * @param[out] entry        Valor del contador de ciclos al entrar a la interrupción
+ * @return \p true          Hay una interrupción en curso y se completaron los parametros
+ * @return \p false         La tarea no se despierta desde una interrupción
+ */
+bool HandlerWakeupSource(uint8_t* service, uint32_t* entry);
+
+/**
+ * @brief Función interna para registrar una latencia de activación en el histograma
+ *
+ * @param[in] service       Numero de la interrupción que despertó a la tarea
+ * @param[in] cycles        Ciclos desde la entrada a la interrupción hasta que se ejecuta la tarea
+ */
+void HandlerLatencyRecord(uint8_t service, uint32_t cycles);
+
+/**
+ * @brief Función interna para leer y opcionalmente borrar el histograma de una interrupción
+ *
+ * @param[in] service       Numero de la interrupción
+ * @param[out] histogram    Vector de @ref EOS_LATENCY_BUCKETS elementos para la copia o NULL
+ * @param[in] reset         Indica si se debe borrar el histograma despues de leerlo
+ */
+void HandlerGetLatency(uint8_t service, uint32_t* histogram, bool reset);
+#endif
+
 /* === Ciere de documentacion ================================================================== */
 #ifdef __cplusplus
 }
@@ -0,0 +1,125 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef MEMORIA_H
+#define MEMORIA_H
+
+/** @file memoria.h
+ ** @brief Declaraciones privadas del sistema operativo para la gestion de bloques de memoria
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+
+#include "eos.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definiciones y Macros =================================================================== */
+
+/* === Declaraciones de tipos de datos ========================================================= */
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/**
+ * @brief Función interna del sistema operativo para consultar la cantidad de grupos disponibles
+ *
+ * @return Cantidad de grupos de bloques de memoria disponibles para ser creados
+ */
+uint32_t PoolAvaiables(void);
+
+/**
+ * @brief Función interna del sistema operativo para crear un grupo de bloques de memoria
+ *
+ * @param[in]   data        Puntero al bloque de memoria alineado a palabra que se divide en bloques
+ * @param[in]   block_size  Tamaño en bytes de cada bloque, debe ser multiplo de cuatro
+ * @param[in]   block_count Cantidad de bloques en los que se divide la memoria suministrada
+ * @return                  Puntero al descriptor del grupo de bloques creado o NULL si no hay
+ *                          descriptores disponibles o los parametros no son validos
+ */
+eos_pool_t PoolCreate(void* data, uint32_t block_size, uint32_t block_count);
+
+/**
+ * @brief Función interna del sistema operativo para asignar un bloque de memoria
+ *
+ * @remark Cuando esta función se llama desde la rutina de servicio de una interrupción y no
+ * hay bloques libres la función retorna NULL. Cuando se llama desde una tarea y no hay bloques
+ * libres la tarea se bloquea y la dirección del bloque asignado se le entrega al despertar.
+ *
+ * @param[in] pool      Puntero al descriptor del grupo de bloques de memoria
+ * @param[in] timeout   Cantidad máxima de ticks que se espera un bloque libre
+ * @return              Dirección del bloque asignado o NULL si no se pudo asignar en forma
+ *                      inmediata
+ */
+void* PoolAllocate(eos_pool_t pool, uint32_t timeout);
+
+/**
+ * @brief Función interna del sistema operativo para liberar un bloque de memoria
+ *
+ * @remark Si una tarea espera un bloque libre se le entrega directamente el bloque liberado.
+ * Las direcciones que no corresponden a un bloque del grupo se ignoran.
+ *
+ * @param[in] pool      Puntero al descriptor del grupo de bloques de memoria
+ * @param[in] block     Dirección del bloque obtenida con @ref PoolAllocate
+ */
+void PoolFree(eos_pool_t pool, void* block);
+
+/**
+ * @brief Función interna del sistema operativo para destruir un grupo de bloques de memoria
+ *
+ * @param pool Puntero al descriptor del grupo de bloques de memoria
+ */
+void PoolDestroy(eos_pool_t pool);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif /* MEMORIA_H */
@@ -0,0 +1,172 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef MUTEX_H
+#define MUTEX_H
+
+/** @file mutex.h
+ ** @brief Declaraciones privadas del sistema operativo para la gestion de mutex
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   7 | 2026.10.16 | evolentini      | Degradacion del dueno de un mutex sin presupuesto       |
+ **|   6 | 2026.10.16 | evolentini      | Error por techo de prioridad inferior a la tarea        |
+ **|   5 | 2026.10.16 | evolentini      | Reduccion de prioridad de tareas que esperan un mutex   |
+ **|   4 | 2026.10.16 | evolentini      | Herencia de prioridad al vencer la espera de un mutex   |
+ **|   3 | 2026.10.16 | evolentini      | Cambio de prioridad de las tareas en ejecucion          |
+ **|   2 | 2026.10.16 | evolentini      | Mutex con techo de prioridad inmediato                  |
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+
+#include "eos.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definiciones y Macros =================================================================== */
+
+/* === Declaraciones de tipos de datos ========================================================= */
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/**
+ * @brief Función interna del sistema operativo para consultar la cantidad de mutex disponibles
+ *
+ * @return Cantidad de mutex disponibles para ser creados
+ */
+uint32_t MutexAvaiables(void);
+
+/**
+ * @brief Función interna del sistema operativo para crear un mutex
+ *
+ * @param[in] ceiling   Prioridad a la que se eleva la tarea que toma el mutex o cero para
+ *                      utilizar herencia de prioridades
+ * @return Puntero al descriptor del mutex creado o NULL si no hay descriptores disponibles
+ */
+eos_mutex_t MutexCreate(uint8_t ceiling);
+
+/**
+ * @brief Función interna del sistema operativo para tomar un mutex
+ *
+ * @remark El mutex se puede tomar en forma recursiva por la tarea que lo posee. Si el mutex tiene
+ * techo de prioridad, la tarea que lo toma se eleva en forma inmediata hasta el techo y, si su
+ * prioridad asignada es mayor que el techo, se informa el error @ref EOS_ERRROR_MUTEX_CEILING. Si
+ * el mutex pertenece a otra tarea, la tarea se bloquea y el dueño del mutex, junto con los dueños
+ * de los mutex por los que este a su vez espera, heredan su prioridad. El resultado definitivo se
+ * le entrega a la tarea al despertar, cuando recibe el mutex o cuando vence el tiempo de espera.
+ *
+ * @param[in] mutex     Puntero al descriptor del mutex
+ * @param[in] timeout   Cantidad máxima de ticks que la tarea puede esperar el mutex
+ * @return \p true      El mutex se tomó correctamente
+ * @return \p false     El mutex no se pudo tomar en forma inmediata
+ */
+bool MutexLock(eos_mutex_t mutex, uint32_t timeout);
+
+/**
+ * @brief Función interna del sistema operativo para liberar un mutex
+ *
+ * @remark Cuando se libera la ultima toma recursiva el mutex se entrega a la tarea de mayor
+ * prioridad que lo espera y la tarea que lo liberó recupera la prioridad que le corresponde por
+ * los mutex que todavía posee.
+ *
+ * @param[in] mutex     Puntero al descriptor del mutex
+ * @return \p true      El mutex se liberó correctamente
+ * @return \p false     El mutex no pertenece a la tarea en ejecución
+ */
+bool MutexUnlock(eos_mutex_t mutex);
+
+/**
+ * @brief Función interna del sistema operativo para cambiar la prioridad asignada a una tarea
+ *
+ * @remark La prioridad efectiva de la tarea es la mayor entre la nueva prioridad y la que le
+ * corresponde por los mutex que posee. Si la tarea espera un mutex, los dueños de la cadena de
+ * mutex recalculan su prioridad, por lo que heredan un aumento y dejan de heredar una reducción.
+ *
+ * @param[in] task      Puntero al descriptor de la tarea
+ * @param[in] priority  Nueva prioridad asignada a la tarea
+ */
+void MutexSetBasePriority(eos_task_t task, uint8_t priority);
+
+/**
+ * @brief Función interna del sistema operativo para retirar de un mutex a una tarea cuyo tiempo
+ * de espera venció
+ *
+ * @remark La tarea se retira de la lista de espera y los dueños de la cadena de mutex recuperan la
+ * prioridad que les corresponde sin ella. Si la tarea no espera un mutex no se hace nada.
+ *
+ * @param[in] task      Puntero al descriptor de la tarea
+ */
+void MutexWaitTimeout(eos_task_t task);
+
+/**
+ * @brief Función interna del sistema operativo para degradar al dueño de uno o mas mutex
+ *
+ * @remark La prioridad efectiva de la tarea se reduce a la que hereda por los techos de los mutex
+ * que posee y por las tareas que los esperan, sin considerar su prioridad asignada. Mientras la
+ * tarea no tenga presupuesto disponible los recálculos de la herencia tampoco la consideran, por
+ * lo que la prioridad asignada se recupera al liberar el último mutex o en el primer recálculo
+ * después de reponerse el presupuesto. Si la tarea no posee ningún mutex no se hace nada.
+ *
+ * @param[in] task      Puntero al descriptor de la tarea
+ * @return \p true      La tarea posee al menos un mutex y se redujo su prioridad
+ * @return \p false     La tarea no posee ningún mutex
+ */
+bool MutexDemote(eos_task_t task);
+
+/**
+ * @brief Función interna del sistema operativo para destruir un mutex
+ *
+ * @param mutex Puntero al descriptor del mutex
+ */
+void MutexDestroy(eos_mutex_t mutex);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif /* MUTEX_H */
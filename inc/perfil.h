@@ -0,0 +1,133 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PERFIL_H
+#define PERFIL_H
+
+/** @file perfil.h
+ ** @brief Declaraciones privadas del sistema operativo para el perfilado estadistico por muestreo
+ **
+ ** El formato del registro de muestras es el que interpreta la herramienta tools/perfil/perfil.py,
+ ** por lo que cualquier cambio en las estructuras debe incrementar la versión.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+
+#include "eos.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Valor que identifica al registro de muestras en un volcado de memoria, "EOSP" en little endian
+#define PROFILE_MAGIC 0x50534F45U
+
+//! Versión del formato de los registros de muestras
+#define PROFILE_VERSION 1
+
+/* === Declaraciones de tipos de datos ========================================================= */
+
+//! Estructura de datos con una muestra del contador de programa
+typedef struct profile_sample_s {
+    //! Dirección de la instrucción interrumpida o cero si se interrumpió al nucleo
+    uint32_t pc;
+    //! Identificador de la tarea en ejecución, cero para la tarea inactiva
+    uint8_t task;
+    //! Indica que la interrupción ocurrió en un handler y no en la ejecución de una tarea
+    uint8_t handler;
+    //! Reservado para mantener la alineación de las muestras
+    uint16_t reserved;
+} * profile_sample_t;
+
+//! Estructura de datos con el registro circular de muestras
+typedef struct profile_buffer_s {
+    //! Valor fijo @ref PROFILE_MAGIC para reconocer el registro en un volcado de memoria
+    uint32_t magic;
+    //! Versión del formato, @ref PROFILE_VERSION
+    uint16_t version;
+    //! Cantidad de muestras que se pueden almacenar en el registro
+    uint16_t size;
+    //! Cantidad de muestras por segundo
+    uint32_t frequency;
+    //! Cantidad total de muestras tomadas, las mas antiguas se sobreescriben
+    uint32_t written;
+    //! Vector circular con las muestras tomadas
+    struct profile_sample_s samples[EOS_PROFILER_SIZE];
+} * profile_buffer_t;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+#if EOS_PROFILER
+/**
+ * @brief Función interna del sistema operativo para iniciar el perfilado
+ *
+ * @param[in] tick_frequency    Cantidad de interrupciones por segundo del temporizador del sistema
+ */
+void ProfilerStart(uint32_t tick_frequency);
+
+/**
+ * @brief Función interna del sistema operativo para muestrear el contador de programa
+ *
+ * @remark Se llama en cada interrupción del temporizador del sistema y solo almacena una muestra
+ * cada @ref EOS_PROFILER_PERIOD llamadas. Cuando el registro esta lleno se sobreescribe la
+ * muestra mas antigua.
+ *
+ * @param[in] pc        Dirección de la instrucción interrumpida o cero si no se conoce
+ * @param[in] handler   Indica que se interrumpió un handler y no la ejecución de una tarea
+ */
+void ProfilerSample(uint32_t pc, bool handler);
+#endif
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif /* PERFIL_H */
@@ -0,0 +1,113 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PERIODICAS_H
+#define PERIODICAS_H
+
+/** @file periodicas.h
+ ** @brief Declaraciones privadas del sistema operativo para los trabajos de las tareas periodicas
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+
+#include "eos.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definiciones y Macros =================================================================== */
+
+/* === Declaraciones de tipos de datos ========================================================= */
+
+//! Estructura de datos con los tiempos de los trabajos de una tarea periodica
+typedef struct periodic_s {
+    //! Cantidad de ticks entre las liberaciones de los trabajos
+    uint32_t period;
+    //! Tick en el que se liberó el trabajo en curso
+    uint32_t release;
+    //! Cantidad de trabajos que terminaron despues de su plazo
+    uint32_t misses;
+} * periodic_t;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+/**
+ * @brief Función interna del sistema operativo para liberar el primer trabajo de una tarea
+ *
+ * @remark Se llama al crear la tarea, por lo que el plazo del primer trabajo se cuenta desde la
+ * creación y no desde que la tarea recibe el procesador por primera vez.
+ *
+ * @param[in] periodic  Puntero a los tiempos de los trabajos de la tarea
+ * @param[in] period    Cantidad de ticks entre las liberaciones de los trabajos
+ * @param[in] tick      Tick en el que se libera el primer trabajo
+ */
+void PeriodicStart(periodic_t periodic, uint32_t period, uint32_t tick);
+
+/**
+ * @brief Función interna del sistema operativo para registrar la finalización de un trabajo
+ *
+ * @remark Si el trabajo terminó despues de su plazo se incrementa la cantidad de plazos vencidos
+ * y se notifica el error @ref EOS_ERRROR_DEADLINE_MISS.
+ *
+ * @param[in] periodic  Puntero a los tiempos de los trabajos de la tarea
+ * @param[in] deadline  Cantidad de ticks desde la liberación del trabajo hasta su plazo
+ * @param[in] tick      Tick en el que terminó el trabajo
+ * @return \p true      El trabajo terminó despues de su plazo
+ * @return \p false     El trabajo terminó dentro de su plazo
+ */
+bool PeriodicComplete(periodic_t periodic, uint32_t deadline, uint32_t tick);
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif /* PERIODICAS_H */
@@ -41,6 +41,10 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   7 | 2026.10.16 | evolentini      | Particiones de tiempo con un planificador cada una      |
+ **|   6 | 2026.10.16 | evolentini      | Umbral de desalojo de las tareas                        |
+ **|   5 | 2026.10.16 | evolentini      | Mutex con herencia de prioridades                       |
+ **|   4 | 2026.10.16 | evolentini      | Reparto del procesador entre tareas de igual prioridad  |
  **|   3 | 2021.08.09 | evolentini      | Se separan las funciones publicas y privadas del SO     |
  **|   2 | 2021.08.08 | evolentini      | Se agrega soporte para una tarea inactiva del sistema   |
  **|   1 | 2021.08.08 | evolentini      | Version inicial del archivo                             |
@@ -71,9 +75,14 @@ typedef struct scheduler_s* scheduler_t;
 /* === Declaraciones de funciones externas ===================================================== */
 
 /**
- * @brief Funcion para crear el planificador del sistema operativo
+ * @brief Funcion para crear el planificador de una partición del sistema operativo
+ *
+ * @param   background_task Puntero a la tarea que se ejecuta cuando no hay tareas listas
+ * @param   partition       Partición del planificador, menor que @ref EOS_MAX_PARTITIONS
+ *
+ * @return  Puntero a la instancia del planificador de la partición
  */
-scheduler_t SchedulerCreate(eos_task_t background_task);
+scheduler_t SchedulerCreate(eos_task_t background_task, uint8_t partition);
 
 /**
  * @brief Función para agregar una tarea en la cola correspondiente a una prioridad
@@ -84,6 +93,35 @@ scheduler_t SchedulerCreate(eos_task_t background_task);
  */
 void SchedulerEnqueue(scheduler_t scheduler, eos_task_t task, uint8_t priority);
 
+/**
+ * @brief Función para consultar si hay tareas listas para ejecutar con una prioridad
+ *
+ * @param   scheduler   Puntero a la instancia del planificador
+ * @param   priority    Prioridad que se desea consultar
+ *
+ * @return  Verdadero si la cola de tareas listas de la prioridad no esta vacia
+ */
+bool SchedulerHasReady(scheduler_t scheduler, uint8_t priority);
+
+/**
+ * @brief Función para consultar si hay tareas listas para ejecutar con una prioridad mayor a otra
+ *
+ * @param   scheduler   Puntero a la instancia del planificador
+ * @param   priority    Prioridad que deben superar las tareas listas
+ *
+ * @return  Verdadero si alguna cola de tareas listas de mayor prioridad no esta vacia
+ */
+bool SchedulerHasReadyAbove(scheduler_t scheduler, uint8_t priority);
+
+/**
+ * @brief Función para retirar una tarea lista de la cola correspondiente a su prioridad
+ *
+ * @param   scheduler   Puntero a la instancia del planificador
+ * @param   task        Puntero al descriptor de la tarea que se retira
+ * @param   priority    Prioridad con la que se encoló la tarea
+ */
+void SchedulerRemove(scheduler_t scheduler, eos_task_t task, uint8_t priority);
+
 /**
  * @brief Función para determinar la tarea a la que se otorga el procesador
  *
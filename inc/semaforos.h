@@ -41,6 +41,8 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   4 | 2026.10.16 | evolentini      | Esperas en semaforos ordenadas por prioridad            |
+ **|   3 | 2026.10.16 | evolentini      | Tiempo maximo de espera en semaforos y colas            |
  **|   2 | 2021.08.15 | evolentini      | Compatibilidad con los handlers de interrupciones       |
  **|   1 | 2021.08.08 | evolentini      | Version inicial del archivo                             |
  **
@@ -84,14 +86,18 @@ void SemaphoreGive(eos_semaphore_t semaphore);
  * @brief Función interna del sistema operativo para tomar un semaforo
  *
  * @remark Cuando esta función se llama desde la rutina de servicio de una interrupción
- * y el semaforo no está disponible la función retorna \p false.
+ * y el semaforo no está disponible la función retorna \p false. Cuando se llama desde una tarea
+ * y el semaforo no esta disponible la tarea se bloquea y el resultado definitivo se le entrega
+ * al despertar, cuando se otorga el semaforo o cuando vence el tiempo de espera. Las tareas que
+ * esperan reciben el semaforo por orden de llegada o, si se habilita la opción
+ * @ref EOS_SEMAPHORE_PRIORITY_ORDER, por orden de prioridad.
  *
  * @param semaphore     Puntero al descriptor del semaforo
+ * @param timeout       Cantidad máxima de ticks que la tarea puede esperar el semaforo
  * @return \p true      El semaforo se pudo tomar correctamente
- * @return \p false     El semaforo no se pudo tomar porque estaba ocuapado y la función
- *                      se llamó desde la rutina de servicio de una interrupción
+ * @return \p false     El semaforo no se pudo tomar en forma inmediata
  */
-bool SemaphoreTake(eos_semaphore_t semaphore);
+bool SemaphoreTake(eos_semaphore_t semaphore, uint32_t timeout);
 
 /* === Ciere de documentacion ================================================================== */
 #ifdef __cplusplus
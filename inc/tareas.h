@@ -41,6 +41,24 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|  27 | 2026.10.16 | evolentini      | Tamano de pila por tarea y pilas suministradas          |
+ **|  26 | 2026.10.16 | evolentini      | Uso maximo de pila y deteccion de desbordes             |
+ **|  25 | 2026.10.16 | evolentini      | Perfilado estadistico por muestreo en el SysTick        |
+ **|  24 | 2026.10.16 | evolentini      | Registro de eventos del nucleo en memoria               |
+ **|  23 | 2026.10.16 | evolentini      | Estadisticas de uso del procesador por tarea e IRQ      |
+ **|  22 | 2026.10.16 | evolentini      | Particiones de tiempo con un planificador cada una      |
+ **|  21 | 2026.10.16 | evolentini      | Presupuesto de ciclos de ejecucion de las tareas        |
+ **|  20 | 2026.10.16 | evolentini      | Tareas periodicas y esperas hasta un tick absoluto      |
+ **|  19 | 2026.10.16 | evolentini      | Planificador por vencimiento del plazo mas proximo      |
+ **|  18 | 2026.10.16 | evolentini      | Umbral de desalojo de las tareas                        |
+ **|  17 | 2026.10.16 | evolentini      | Cambio de prioridad de las tareas en ejecucion          |
+ **|  16 | 2026.10.16 | evolentini      | Esperas en semaforos ordenadas por prioridad            |
+ **|  15 | 2026.10.16 | evolentini      | Mutex con herencia de prioridades                       |
+ **|  14 | 2026.10.16 | evolentini      | Colas como objetos del nucleo con un unico servicio     |
+ **|  13 | 2026.10.16 | evolentini      | Tiempo maximo de espera en semaforos y colas            |
+ **|  12 | 2026.10.16 | evolentini      | Modo sin ticks cuando solo se ejecuta la tarea inactiva |
+ **|  11 | 2026.10.16 | evolentini      | Reparto del procesador entre tareas de igual prioridad  |
+ **|  10 | 2026.10.16 | evolentini      | Listas de tareas doblemente enlazadas                   |
  **|   9 | 2021.08.16 | evolentini      | Se mueven las notificaciones al usuario a la API        |
  **|   8 | 2021.08.09 | evolentini      | Se publican funciones necesarias implementar semaforos  |
  **|   7 | 2021.08.10 | evolentini      | Soporte para encolar las tareas con una lista enlazada  |
@@ -58,6 +76,7 @@
 /* === Inclusiones de archivos externos ======================================================== */
 
 #include "eos.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 /* === Cabecera C++ ============================================================================ */
@@ -79,6 +98,33 @@ typedef enum eos_task_state_e {
     RUNNING,
 } eos_task_state_t;
 
+/**
+ * @brief Estructura de una lista de tareas enlazada a traves de sus descriptores
+ *
+ * @remark Cada tarea puede pertenecer a una sola lista por vez, el descriptor de la tarea
+ * almacena los enlaces y una referencia a la lista para poder retirarla en cualquier momento.
+ */
+typedef struct task_list_s {
+    //! Puntero al descriptor de la primera tarea de la lista
+    eos_task_t first;
+    //! Puntero al descriptor de la ultima tarea de la lista
+    eos_task_t last;
+} * task_list_t;
+
+/**
+ * @brief Estructura de una lista de espera ordenada por prioridad
+ *
+ * @remark Cada prioridad tiene su propia lista, en la que se respeta el orden de llegada, y un bit
+ * indica las prioridades con tareas en espera, por lo que tanto agregar una tarea como buscar la
+ * de mayor prioridad se resuelven en tiempo constante.
+ */
+typedef struct task_queue_s {
+    //! Mapa de bits con las prioridades que tienen tareas en espera
+    uint32_t waiting;
+    //! Listas de las tareas que esperan, una para cada prioridad
+    struct task_list_s lists[EOS_MAX_PRIORITY];
+} * task_queue_t;
+
 /* === Declaraciones de variables externas ===================================================== */
 
 /* === Declaraciones de funciones externas ===================================================== */
@@ -94,6 +140,52 @@ typedef enum eos_task_state_e {
  */
 eos_task_t TaskCreate(eos_entry_point_t entry_point, void* data, uint8_t priority);
 
+/**
+ * @brief Función para crear una nueva tarea con un tamaño de pila o una pila propia
+ *
+ * @param[in]  entry_point  Puntero a la función que implementa la tarea
+ * @param[in]  data         Puntero al bloque de datos para parametrizar la tarea
+ * @param[in]  priority     Prioridad de la tarea que se desea crear
+ * @param[in]  stack        Bloque de memoria alineado a 8 bytes para la pila o NULL para
+ *                          reservarla en el espacio para pilas del sistema operativo
+ * @param[in]  size         Cantidad de bytes de la pila
+ *
+ * @return                  Puntero al descriptor de la tarea creada o NULL si no hay espacio
+ */
+eos_task_t TaskCreateStack(
+    eos_entry_point_t entry_point, void* data, uint8_t priority, void* stack, uint16_t size);
+
+/**
+ * @brief Función para crear una tarea periodica
+ *
+ * @param[in]  entry_point  Puntero a la función que implementa un trabajo de la tarea
+ * @param[in]  data         Puntero al bloque de datos para parametrizar cada trabajo
+ * @param[in]  priority     Prioridad de la tarea que se desea crear
+ * @param[in]  period       Cantidad de ticks entre las liberaciones de los trabajos
+ * @param[in]  deadline     Plazo de cada trabajo desde su liberación, cero para usar el periodo
+ *
+ * @return                  Puntero al descriptor de la tarea creada
+ */
+eos_task_t TaskCreatePeriodic(eos_entry_point_t entry_point, void* data, uint8_t priority,
+    uint32_t period, uint32_t deadline);
+
+/**
+ * @brief Función para obtener la cantidad de plazos incumplidos de una tarea periodica
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @return          Cantidad de trabajos que terminaron despues del vencimiento de su plazo
+ */
+uint32_t TaskDeadlineMisses(eos_task_t task);
+
+/**
+ * @brief Función para bloquear la tarea en ejecución hasta un tick absoluto
+ *
+ * @remark Si el tick ya transcurrió la tarea no se bloquea
+ *
+ * @param   tick    Valor del contador de ticks en el que se debe despertar la tarea
+ */
+void TaskWaitUntil(uint32_t tick);
+
 /**
  * @brief Función para cambiar el estado de una tarea
  *
@@ -102,6 +194,276 @@ eos_task_t TaskCreate(eos_entry_point_t entry_point, void* data, uint8_t priorit
  */
 void TaskSetState(eos_task_t task, eos_task_state_t state);
 
+/**
+ * @brief Función para cambiar la cantidad de ticks que una tarea puede usar el procesador antes
+ * de cederlo a otra tarea lista con su misma prioridad
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @param   ticks   Cantidad de ticks asignados a la tarea, cero deshabilita el reparto de tiempo
+ */
+void TaskSetTimeSlice(eos_task_t task, uint32_t ticks);
+
+/**
+ * @brief Función para obtener la prioridad efectiva de una tarea
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @return          Prioridad con la que se planifica la tarea, incluyendo la heredada
+ */
+uint8_t TaskGetPriority(eos_task_t task);
+
+/**
+ * @brief Función para obtener la prioridad asignada a una tarea
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @return          Prioridad de la tarea sin considerar la herencia de prioridades
+ */
+uint8_t TaskGetBasePriority(eos_task_t task);
+
+#if EOS_STACK_CHECK
+/**
+ * @brief Función para obtener la máxima cantidad de bytes de pila que utilizó una tarea
+ *
+ * @param   task    Puntero al descriptor de la tarea o NULL para la tarea inactiva
+ * @return          Cantidad de bytes de la pila que fueron modificados desde su creación
+ */
+uint16_t TaskStackHighWater(eos_task_t task);
+#endif
+
+/**
+ * @brief Función para cambiar la prioridad asignada a una tarea
+ *
+ * @remark Esta función no modifica la prioridad efectiva de la tarea, que se debe recalcular
+ * considerando los mutex que posee la tarea.
+ *
+ * @param   task        Puntero al descriptor de la tarea
+ * @param   priority    Nueva prioridad asignada a la tarea
+ */
+void TaskSetBasePriority(eos_task_t task, uint8_t priority);
+
+/**
+ * @brief Función para cambiar el plazo relativo de una tarea
+ *
+ * @remark Con el planificador por plazos el vencimiento del trabajo en curso se recalcula a partir
+ * de su liberación con el nuevo plazo y, si la tarea esta lista, se reubica en el planificador.
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @param   ticks   Cantidad de ticks desde la liberación de la tarea hasta el vencimiento de su
+ *                  plazo, cero indica que la tarea no tiene plazo
+ */
+void TaskSetDeadline(eos_task_t task, uint32_t ticks);
+
+/**
+ * @brief Función para obtener el vencimiento absoluto del plazo de una tarea
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @return          Tick en el que vence el plazo calculado en la ultima liberación de la tarea
+ */
+uint32_t TaskGetDeadline(eos_task_t task);
+
+#if EOS_SCHEDULER_EDF
+/**
+ * @brief Función para guardar la posición de una tarea en el monticulo de tareas listas
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @param   index   Indice del elemento del monticulo que ocupa la tarea
+ */
+void TaskSetReadyIndex(eos_task_t task, uint32_t index);
+
+/**
+ * @brief Función para obtener la posición de una tarea en el monticulo de tareas listas
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @return          Indice guardado con la ultima llamada a @ref TaskSetReadyIndex
+ */
+uint32_t TaskGetReadyIndex(eos_task_t task);
+#endif
+
+#if EOS_TASK_BUDGET
+/**
+ * @brief Función para asignar a una tarea un presupuesto de ciclos por periodo
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @param   cycles  Cantidad de ciclos que puede ejecutar la tarea en cada periodo, cero sin limite
+ * @param   period  Cantidad de ticks entre las reposiciones del presupuesto
+ */
+void TaskSetBudget(eos_task_t task, uint32_t cycles, uint32_t period);
+
+/**
+ * @brief Función para saber si una tarea agotó su presupuesto de ciclos en el periodo actual
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @return  true    La tarea tiene un presupuesto asignado y ya lo consumió
+ * @return  false   La tarea no tiene presupuesto o todavía le quedan ciclos disponibles
+ */
+bool TaskBudgetExhausted(eos_task_t task);
+#endif
+
+#if EOS_TASK_STATS
+/**
+ * @brief Función para cambiar el acumulador al que se cargan los ciclos del procesador
+ *
+ * @remark Se llama al entrar y al salir de un handler de interrupción. Los ciclos transcurridos
+ * hasta el cambio se cargan al acumulador anterior, que puede ser el de otro handler anidado.
+ *
+ * @param   cycles  Acumulador del handler que comienza o NULL para volver a cargar a la tarea
+ * @return          Acumulador anterior, que se debe restaurar al terminar el handler
+ */
+uint64_t* TaskStatsHandler(uint64_t* cycles);
+
+/**
+ * @brief Función para calcular el porcentaje de uso del procesador de unas estadisticas
+ *
+ * @param   stats   Estadisticas con los ciclos acumulados, en las que se completa el porcentaje
+ */
+void TaskStatsLoad(eos_stats_t stats);
+
+/**
+ * @brief Función para obtener las estadisticas de uso del procesador de una tarea
+ *
+ * @param   task    Puntero al descriptor de la tarea o NULL para la tarea inactiva
+ * @param   stats   Estructura en la que se devuelven las estadisticas
+ */
+void TaskGetStats(eos_task_t task, eos_stats_t stats);
+#endif
+
+/**
+ * @brief Función para asignar una tarea a una partición
+ *
+ * @param   task        Puntero al descriptor de la tarea
+ * @param   partition   Partición a la que se asigna la tarea
+ * @return  \p true     La tarea se asignó a la partición
+ * @return  \p false    El planificador ya se inició y la tarea no se puede cambiar de partición
+ */
+bool TaskSetPartition(eos_task_t task, uint8_t partition);
+
+/**
+ * @brief Función para definir el marco principal de ventanas de tiempo de las particiones
+ *
+ * @param   windows     Vector con las ventanas del marco principal
+ * @param   count       Cantidad de ventanas del marco principal
+ * @return  \p true     El marco principal se definió correctamente
+ * @return  \p false    El planificador ya se inició y el marco principal no se puede cambiar
+ */
+bool TaskPartitionSchedule(eos_window_t windows, uint8_t count);
+
+/**
+ * @brief Función para cambiar el umbral de desalojo de una tarea
+ *
+ * @remark Mientras la tarea se ejecuta solo la pueden desalojar las tareas con una prioridad mayor
+ * que el umbral. Un umbral menor o igual que la prioridad efectiva de la tarea no tiene efecto.
+ *
+ * @param   task        Puntero al descriptor de la tarea
+ * @param   threshold   Prioridad que debe superar una tarea lista para desalojarla
+ */
+void TaskSetThreshold(eos_task_t task, uint8_t threshold);
+
+/**
+ * @brief Función para cambiar la prioridad efectiva de una tarea
+ *
+ * @remark Si la tarea esta lista para ejecutar se mueve a la cola de la nueva prioridad y si
+ * espera en una lista ordenada por prioridad se mueve a la lista de la nueva prioridad.
+ *
+ * @param   task        Puntero al descriptor de la tarea
+ * @param   priority    Nueva prioridad con la que se planifica la tarea
+ */
+void TaskSetPriority(eos_task_t task, uint8_t priority);
+
+/**
+ * @brief Función para obtener la lista en la que se encuentra una tarea
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @return          Puntero a la lista de espera o de tareas listas, NULL si no esta en una lista
+ */
+task_list_t TaskGetList(eos_task_t task);
+
+/**
+ * @brief Función para obtener la tarea siguiente en la lista en la que se encuentra una tarea
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @return          Puntero a la tarea siguiente o NULL si es la ultima de la lista
+ */
+eos_task_t TaskNext(eos_task_t task);
+
+/**
+ * @brief Función para bloquear la tarea en ejecución con un tiempo máximo de espera
+ *
+ * @remark El resultado del servicio que bloqueó la tarea es falso a menos que la tarea se despierte
+ * con @ref TaskWakeup antes del vencimiento del tiempo de espera.
+ *
+ * @param   list    Lista de espera en la que se agrega la tarea o NULL para una espera de tiempo
+ * @param   timeout Cantidad máxima de ticks de espera o @ref EOS_WAIT_FOREVER para esperar sin
+ *                  limite de tiempo
+ */
+void TaskWait(task_list_t list, uint32_t timeout);
+
+/**
+ * @brief Función para bloquear la tarea en ejecución en una lista de espera ordenada por prioridad
+ *
+ * @remark Si la prioridad efectiva de la tarea cambia mientras espera, la tarea se mueve a la
+ * lista de su nueva prioridad.
+ *
+ * @param   queue   Lista de espera ordenada por prioridad en la que se agrega la tarea
+ * @param   timeout Cantidad máxima de ticks de espera o @ref EOS_WAIT_FOREVER para esperar sin
+ *                  limite de tiempo
+ */
+void TaskQueueWait(task_queue_t queue, uint32_t timeout);
+
+/**
+ * @brief Función para obtener la tarea de mayor prioridad en una lista de espera ordenada
+ *
+ * @remark Entre las tareas de igual prioridad se devuelve la que llegó primero.
+ *
+ * @param   queue   Lista de espera ordenada por prioridad
+ * @return          Puntero a la tarea de mayor prioridad o NULL si ninguna tarea espera
+ */
+eos_task_t TaskQueueFirst(task_queue_t queue);
+
+/**
+ * @brief Función para despertar una tarea bloqueada antes del vencimiento de su espera
+ *
+ * @remark La tarea se retira de la lista de espera y de la lista de esperas temporizadas y
+ * el resultado se entrega como valor de retorno del servicio que bloqueó a la tarea.
+ *
+ * @param   task    Puntero al descriptor de la tarea que se despierta
+ * @param   result  Resultado que se devuelve a la tarea en el servicio que la bloqueó
+ */
+void TaskWakeup(eos_task_t task, uint32_t result);
+
+/**
+ * @brief Función para asignar el bloque de datos que una tarea intercambia mientras espera
+ *
+ * @remark Permite que el objeto que despierta a la tarea complete la transferencia de datos
+ * sin que la tarea tenga que volver a solicitar el servicio.
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @param   buffer  Puntero al bloque de datos de la tarea
+ */
+void TaskSetBuffer(eos_task_t task, void* buffer);
+
+/**
+ * @brief Función para obtener el bloque de datos que una tarea intercambia mientras espera
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @return          Puntero al bloque de datos asignado con @ref TaskSetBuffer
+ */
+void* TaskGetBuffer(eos_task_t task);
+
+/**
+ * @brief Función para obtener la cantidad de ticks transcurridos desde el inicio del planificador
+ *
+ * @return Cantidad de ticks del temporizador del sistema
+ */
+uint32_t TaskTickCount(void);
+
+/**
+ * @brief Función para terminar una espera sin ticks y corregir la cuenta de ticks del sistema
+ *
+ * @remark Con la opción @ref EOS_TICKLESS_IDLE se debe llamar al inicio de cada interrupción, si
+ * el temporizador del sistema no esta programado para una espera sin ticks la función no tiene
+ * efecto.
+ */
+void TicklessWakeup(void);
+
 /**
  * @brief Función para obtener puntero al descriptor de la tarea actual
  *
@@ -109,6 +471,16 @@ void TaskSetState(eos_task_t task, eos_task_state_t state);
  */
 eos_task_t TaskGetDescriptor(void);
 
+#if EOS_TRACE || EOS_PROFILER
+/**
+ * @brief Función para obtener el identificador de una tarea en el registro de eventos
+ *
+ * @param   task    Puntero al descriptor de la tarea
+ * @return          Orden de creación de la tarea a partir de uno, cero para la tarea inactiva
+ */
+uint8_t TaskIdentifier(eos_task_t task);
+#endif
+
 /**
  * @brief Función para iniciar el planificador del sistema operativo
  */
@@ -120,20 +492,29 @@ void StartScheduler(void);
 void SchedulingRequired(void);
 
 /**
- * @brief Función para encolar una tarea en una cola de tareas
+ * @brief Función para agregar una tarea al final de una lista de tareas
  *
- * @param first_task Puntero al descriptor de la primera tarea de la cola
- * @param last_task Puntero al descriptor de tarea que se agrega al final de la cola
+ * @param list  Puntero a la lista en la que se agrega la tarea
+ * @param task  Puntero al descriptor de tarea que se agrega al final de la lista
  */
-void TaskEnqueue(eos_task_t first_task, eos_task_t last_task);
+void TaskEnqueue(task_list_t list, eos_task_t task);
 
 /**
- * @brief Función para desencolar la primera tarea de una cola de tareas
+ * @brief Función para retirar la primera tarea de una lista de tareas
+ *
+ * @param list  Puntero a la lista de la que se retira la tarea
+ * @return      Puntero al descriptor de la tarea retirada o NULL si la lista estaba vacia
+ */
+eos_task_t TaskDequeue(task_list_t list);
+
+/**
+ * @brief Función para retirar una tarea de la lista en la que se encuentra
+ *
+ * @remark Si la tarea no pertenece a ninguna lista la función no tiene efecto
  *
- * @param first_task Puntero al descriptor de la primera tarea de la cola
- * @return  Puntero al descriptor de la nueva primera tarea de la cola
+ * @param task  Puntero al descriptor de la tarea que se retira
  */
-eos_task_t TaskDequeue(eos_task_t first_task);
+void TaskRemove(eos_task_t task);
 
 /* === Ciere de documentacion ================================================================== */
 #ifdef __cplusplus
@@ -0,0 +1,178 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef TRAZA_H
+#define TRAZA_H
+
+/** @file traza.h
+ ** @brief Declaraciones privadas del sistema operativo para el registro de eventos del nucleo
+ **
+ ** El formato del registro en memoria es el que interpreta la herramienta tools/traza/traza2json,
+ ** por lo que cualquier cambio en las estructuras o en los eventos debe incrementar la versión.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de archivos externos ======================================================== */
+
+#include "eos.h"
+
+/* === Cabecera C++ ============================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Valor que identifica al registro de eventos en un volcado de memoria, "EOST" en little endian
+#define TRACE_MAGIC 0x54534F45U
+
+//! Versión del formato de los registros de eventos
+#define TRACE_VERSION 1
+
+#if EOS_TRACE
+//! Agrega un evento al registro si la opción @ref EOS_TRACE esta habilitada
+#define TRACE_EVENT(event, data) TraceRecord(event, data)
+//! Agrega al registro un evento de otra tarea si la opción @ref EOS_TRACE esta habilitada
+#define TRACE_TASK_EVENT(event, task, data) TraceRecordTask(event, task, data)
+#else
+#define TRACE_EVENT(event, data)
+#define TRACE_TASK_EVENT(event, task, data)
+#endif
+
+/* === Declaraciones de tipos de datos ========================================================= */
+
+//! Tipo de datos enumerado con los eventos del nucleo que se registran
+typedef enum {
+    //! El planificador asignó el procesador a la tarea del registro
+    TRACE_SWITCH = 1,
+    //! La tarea del registro llamó al servicio del sistema indicado en el dato
+    TRACE_SERVICE,
+    //! Se liberó una unidad del semaforo indicado en el dato
+    TRACE_SEMAPHORE_GIVE,
+    //! Se tomó una unidad del semaforo indicado en el dato
+    TRACE_SEMAPHORE_TAKE,
+    //! La tarea del registro se bloqueó esperando el semaforo indicado en el dato
+    TRACE_SEMAPHORE_BLOCK,
+    //! Se agregó un elemento en la cola indicada en el dato
+    TRACE_QUEUE_GIVE,
+    //! Se retiró un elemento de la cola indicada en el dato
+    TRACE_QUEUE_TAKE,
+    //! La tarea del registro se bloqueó esperando la cola indicada en el dato
+    TRACE_QUEUE_BLOCK,
+    //! Comenzó la atención de la interrupción indicada en el dato
+    TRACE_HANDLER_ENTER,
+    //! Terminó la atención de la interrupción indicada en el dato
+    TRACE_HANDLER_EXIT,
+} trace_event_t;
+
+//! Estructura de datos con un evento registrado
+typedef struct trace_record_s {
+    //! Valor del contador de ciclos del procesador en el momento del evento
+    uint32_t time;
+    //! Tipo de evento registrado, definido en @ref trace_event_t
+    uint8_t event;
+    //! Identificador de la tarea del evento, cero para la tarea inactiva
+    uint8_t task;
+    //! Dato del evento: servicio, numero de interrupción o indice del semaforo o la cola
+    uint16_t data;
+} * trace_record_t;
+
+//! Estructura de datos con el registro circular de eventos
+typedef struct trace_buffer_s {
+    //! Valor fijo @ref TRACE_MAGIC para reconocer el registro en un volcado de memoria
+    uint32_t magic;
+    //! Versión del formato, @ref TRACE_VERSION
+    uint16_t version;
+    //! Cantidad de eventos que se pueden almacenar en el registro
+    uint16_t size;
+    //! Frecuencia en Hz del contador de ciclos del procesador
+    uint32_t frequency;
+    //! Cantidad total de eventos registrados, los mas antiguos se sobreescriben
+    uint32_t written;
+    //! Vector circular con los eventos registrados
+    struct trace_record_s records[EOS_TRACE_SIZE];
+} * trace_buffer_t;
+
+/* === Declaraciones de variables externas ===================================================== */
+
+/* === Declaraciones de funciones externas ===================================================== */
+
+#if EOS_TRACE
+/**
+ * @brief Función interna del sistema operativo para iniciar el registro de eventos
+ *
+ * @remark Completa la frecuencia del contador de ciclos, que debe estar habilitado
+ */
+void TraceStart(void);
+
+/**
+ * @brief Función interna del sistema operativo para agregar un evento al registro
+ *
+ * @remark El evento se marca con el contador de ciclos y con la tarea en ejecución. Cuando el
+ * registro esta lleno se sobreescribe el evento mas antiguo.
+ *
+ * @param[in] event     Tipo de evento, definido en @ref trace_event_t
+ * @param[in] data      Dato asociado al evento
+ */
+void TraceRecord(uint8_t event, uint16_t data);
+
+/**
+ * @brief Función interna del sistema operativo para agregar al registro un evento de otra tarea
+ *
+ * @remark Se usa cuando una tarea bloqueada recibe un dato o un lugar de la tarea en ejecución,
+ * para que el evento que termina su espera quede registrado con su propio identificador.
+ *
+ * @param[in] event     Tipo de evento, definido en @ref trace_event_t
+ * @param[in] task      Puntero al descriptor de la tarea a la que corresponde el evento
+ * @param[in] data      Dato asociado al evento
+ */
+void TraceRecordTask(uint8_t event, eos_task_t task, uint16_t data);
+#endif
+
+/* === Ciere de documentacion ================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif /* TRAZA_H */
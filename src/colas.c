@@ -38,6 +38,11 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   7 | 2026.10.16 | evolentini      | Esperas de varias tareas con reservas y adquisiciones   |
+ **|   6 | 2026.10.16 | evolentini      | Registro de eventos del nucleo en memoria               |
+ **|   5 | 2026.10.16 | evolentini      | Reserva y adquisicion de elementos sin copia en colas   |
+ **|   4 | 2026.10.16 | evolentini      | Colas como objetos del nucleo con un unico servicio     |
+ **|   3 | 2026.10.16 | evolentini      | Tiempo maximo de espera en semaforos y colas            |
  **|   2 | 2021.08.15 | evolentini      | Compatibilidad con los handlers de interrupciones       |
  **|   1 | 2021.08.14 | evolentini      | Version inicial del archivo                             |
  **
@@ -48,7 +53,9 @@
 /* === Inclusiones de cabeceras ================================================================ */
 
 #include "colas.h"
-#include "semaforos.h"
+#include "tareas.h"
+#include "interrupciones.h"
+#include "traza.h"
 #include <stddef.h>
 #include <string.h>
 
@@ -56,7 +63,7 @@
 
 /* === Declaraciones de tipos de datos internos ================================================ */
 
-//! Estructura de datos con la información de un semaforo contador
+//! Estructura de datos con la información de una cola de datos
 struct eos_queue_s {
     //! Puntero al bloque de datos donde se almacenan los elementos
     void* data;
@@ -68,10 +75,20 @@ struct eos_queue_s {
     int32_t index_give;
     //! Indice del vector del que se debe tomar el siguiente dato
     int32_t index_take;
-    //! Semaforo para esperar cuando la cola esta llena
-    eos_semaphore_t full;
-    //! Semaforo para esperar cuando la cola esta vacia
-    eos_semaphore_t empty;
+    //! Cantidad de elementos publicados en la cola que todavía no se retiraron
+    uint32_t count;
+    //! Cantidad de elementos agregados despues del elemento reservado que aun no se publicaron
+    uint32_t pending;
+    //! Cantidad de elementos retirados cuyo lugar todavía no se liberó
+    uint32_t consumed;
+    //! Indica que el primer elemento sin publicar esta reservado por el productor
+    bool reserved;
+    //! Indica que el primer elemento retirado sin liberar esta adquirido por el consumidor
+    bool acquired;
+    //! Lista de las tareas que esperan un lugar libre para agregar un dato
+    struct task_list_s senders[1];
+    //! Lista de las tareas que esperan un dato para retirar de la cola
+    struct task_list_s receivers[1];
 };
 
 /* === Declaraciones de funciones internas ===================================================== */
@@ -90,6 +107,78 @@ static eos_queue_t AllocateDescriptor(void);
  */
 static void* GetElementAddress(eos_queue_t self, uint32_t index);
 
+/**
+ * @brief Calcula la cantidad de lugares de la cola que no se pueden ocupar con un nuevo dato
+ *
+ * @param queue Puntero al descriptor de la cola de datos
+ * @return Cantidad de elementos publicados, pendientes, retirados sin liberar y reservados
+ */
+static uint32_t UsedElements(eos_queue_t self);
+
+/**
+ * @brief Ocupa el siguiente lugar libre de la cola y avanza el indice de ingreso
+ *
+ * @param queue Puntero al descriptor de la cola de datos
+ * @return Dirección de memoria del lugar ocupado
+ */
+static void* AllocateElement(eos_queue_t self);
+
+/**
+ * @brief Retira el siguiente elemento publicado de la cola y avanza el indice de salida
+ *
+ * @remark El lugar del elemento retirado no se libera hasta llamar a @ref ReleaseElements
+ *
+ * @param queue Puntero al descriptor de la cola de datos
+ * @return Dirección de memoria del elemento retirado
+ */
+static void* ConsumeElement(eos_queue_t self);
+
+/**
+ * @brief Copia un dato en el lugar libre de la cola y lo publica
+ *
+ * @remark Si hay un elemento reservado el dato se publica al confirmar la reserva para mantener
+ * el orden de los elementos en la cola.
+ *
+ * @param queue Puntero al descriptor de la cola de datos
+ * @param data  Puntero al bloque con el dato que se debe almacenar en la cola
+ */
+static void StoreElement(eos_queue_t self, void const* const data);
+
+/**
+ * @brief Publica el siguiente elemento de la cola y lo entrega a la primera tarea que lo esperaba
+ *
+ * @param queue Puntero al descriptor de la cola de datos
+ */
+static void PublishElement(eos_queue_t self);
+
+/**
+ * @brief Entrega los elementos publicados a las tareas que esperaban para retirarlos
+ *
+ * @remark Si la primera tarea espera adquirir un elemento mientras ya hay uno adquirido, ella y
+ * las siguientes esperan hasta que se libere ese elemento para mantener el orden de llegada.
+ *
+ * @param queue Puntero al descriptor de la cola de datos
+ */
+static void WakeupReceivers(eos_queue_t self);
+
+/**
+ * @brief Entrega los lugares libres de la cola a las tareas que esperaban para agregar un dato
+ *
+ * @remark Si la primera tarea espera reservar un lugar mientras ya hay uno reservado, ella y
+ * las siguientes esperan hasta que se confirme esa reserva para mantener el orden de llegada.
+ *
+ * @param queue Puntero al descriptor de la cola de datos
+ */
+static void WakeupSenders(eos_queue_t self);
+
+/**
+ * @brief Libera los lugares de los elementos retirados y los entrega a las tareas que esperaban
+ * para agregar un dato
+ *
+ * @param queue Puntero al descriptor de la cola de datos
+ */
+static void ReleaseElements(eos_queue_t self);
+
 /* === Definiciones de variables internas ====================================================== */
 
 static struct eos_queue_s instances[EOS_MAX_QUEUES] = { 0 };
@@ -117,6 +206,101 @@ static void* GetElementAddress(eos_queue_t self, uint32_t index)
     return self->data + self->data_size * index;
 }
 
+static uint32_t UsedElements(eos_queue_t self)
+{
+    return self->count + self->pending + self->consumed + self->reserved;
+}
+
+static void* AllocateElement(eos_queue_t self)
+{
+    void* location = GetElementAddress(self, self->index_give);
+    self->index_give = (self->index_give + 1) % self->data_count;
+    return location;
+}
+
+static void* ConsumeElement(eos_queue_t self)
+{
+    void* location = GetElementAddress(self, self->index_take);
+    self->index_take = (self->index_take + 1) % self->data_count;
+    self->consumed++;
+    return location;
+}
+
+static void StoreElement(eos_queue_t self, void const* const data)
+{
+    memcpy(AllocateElement(self), data, self->data_size);
+    if (self->reserved) {
+        self->pending++;
+    } else {
+        PublishElement(self);
+    }
+}
+
+static void PublishElement(eos_queue_t self)
+{
+    self->count++;
+    WakeupReceivers(self);
+}
+
+static void WakeupReceivers(eos_queue_t self)
+{
+    eos_task_t receiver = self->receivers->first;
+    void* buffer;
+
+    // La tarea se despierta antes de entregarle el elemento porque la entrega puede liberar
+    // lugares y volver a recorrer las listas de espera de la cola
+    while (receiver && self->count) {
+        buffer = TaskGetBuffer(receiver);
+        if (buffer) {
+            self->count--;
+            TRACE_TASK_EVENT(TRACE_QUEUE_TAKE, receiver, self - instances);
+            TaskWakeup(receiver, true);
+            memcpy(buffer, ConsumeElement(self), self->data_size);
+            if (!self->acquired) {
+                ReleaseElements(self);
+            }
+        } else if (!self->acquired) {
+            self->count--;
+            self->acquired = true;
+            TRACE_TASK_EVENT(TRACE_QUEUE_TAKE, receiver, self - instances);
+            TaskWakeup(receiver, (uintptr_t)ConsumeElement(self));
+        } else {
+            break;
+        }
+        receiver = self->receivers->first;
+    }
+}
+
+static void WakeupSenders(eos_queue_t self)
+{
+    eos_task_t sender = self->senders->first;
+    void* buffer;
+
+    // La tarea se despierta antes de agregar su dato porque al publicarlo se puede entregar y
+    // volver a recorrer las listas de espera de la cola
+    while (sender && UsedElements(self) < self->data_count) {
+        buffer = TaskGetBuffer(sender);
+        if (buffer) {
+            TRACE_TASK_EVENT(TRACE_QUEUE_GIVE, sender, self - instances);
+            TaskWakeup(sender, true);
+            StoreElement(self, buffer);
+        } else if (!self->reserved) {
+            self->reserved = true;
+            TaskWakeup(sender, (uintptr_t)AllocateElement(self));
+        } else {
+            break;
+        }
+        sender = self->senders->first;
+    }
+}
+
+static void ReleaseElements(eos_queue_t self)
+{
+    // Los lugares liberados se ocupan con los datos de las tareas que esperaban para agregarlos
+    self->consumed = 0;
+    WakeupSenders(self);
+}
+
 /* === Definiciones de funciones externas ====================================================== */
 
 uint32_t QueueAvaiables(void)
@@ -139,44 +323,130 @@ eos_queue_t QueueCreate(void* data, uint32_t data_count, uint32_t data_size)
         self->data = data;
         self->data_count = data_count;
         self->data_size = data_size;
-        self->full = EosSemaphoreCreate(data_count);
-        self->empty = EosSemaphoreCreate(0);
     }
     return self;
 }
 
-bool QueueGive(eos_queue_t self, void const* const data)
+bool QueueGive(eos_queue_t self, void const* const data, uint32_t timeout)
 {
-    // Intenta obtener un lugar en la cola
-    bool result = EosSemaphoreTake(self->full);
+    bool result = true;
+    eos_task_t receiver = self->receivers->first;
+    uint32_t used = UsedElements(self);
 
-    // Si falla es porque la cola esta llena y estamos en una interupcion
-    if (!result) {
-        void* location = GetElementAddress(self, self->index_give);
-        memcpy(location, data, self->data_size);
-        self->index_give = (self->index_give + 1) % self->data_count;
+    if (receiver && TaskGetBuffer(receiver) && !self->reserved) {
+        // Si una tarea espera un dato la cola esta vacia y se le entrega directamente
+        memcpy(TaskGetBuffer(receiver), data, self->data_size);
+        TaskWakeup(receiver, true);
+        TRACE_EVENT(TRACE_QUEUE_GIVE, self - instances);
+        TRACE_TASK_EVENT(TRACE_QUEUE_TAKE, receiver, self - instances);
+    } else if (used < self->data_count) {
+        StoreElement(self, data);
+        TRACE_EVENT(TRACE_QUEUE_GIVE, self - instances);
+    } else {
+        // La cola esta llena, el dato lo copia la tarea que libere un lugar antes del vencimiento
+        if (!HandlerActive() && timeout) {
+            TRACE_EVENT(TRACE_QUEUE_BLOCK, self - instances);
+            TaskSetBuffer(TaskGetDescriptor(), (void*)data);
+            TaskWait(self->senders, timeout);
+        }
+        result = false;
+    }
+    return result;
+}
 
-        EosSemaphoreGive(self->empty);
+bool QueueTake(eos_queue_t self, void* const data, uint32_t timeout)
+{
+    bool result = true;
+
+    if (self->count > 0) {
+        self->count--;
+        memcpy(data, ConsumeElement(self), self->data_size);
+
+        // Si hay un elemento adquirido anterior el lugar se libera junto con ese elemento
+        if (!self->acquired) {
+            ReleaseElements(self);
+        }
+        TRACE_EVENT(TRACE_QUEUE_TAKE, self - instances);
+    } else {
+        // La cola esta vacia, el dato lo copia la tarea que lo agregue antes del vencimiento
+        if (!HandlerActive() && timeout) {
+            TRACE_EVENT(TRACE_QUEUE_BLOCK, self - instances);
+            TaskSetBuffer(TaskGetDescriptor(), data);
+            TaskWait(self->receivers, timeout);
+        }
+        result = false;
     }
     return result;
 }
 
-bool QueueTake(eos_queue_t self, void* const data)
+void* QueueReserve(eos_queue_t self, uint32_t timeout)
 {
-    // Intenta obtener un elemento de la cola
-    bool result = EosSemaphoreTake(self->empty);
+    void* result = NULL;
+    uint32_t used = UsedElements(self);
+
+    if (!self->reserved && used < self->data_count) {
+        self->reserved = true;
+        result = AllocateElement(self);
+    } else if (!HandlerActive() && timeout) {
+        // Con la cola llena o con otra reserva sin confirmar el lugar lo asigna la tarea que lo
+        // libere o que confirme la reserva anterior antes del vencimiento
+        TRACE_EVENT(TRACE_QUEUE_BLOCK, self - instances);
+        TaskSetBuffer(TaskGetDescriptor(), NULL);
+        TaskWait(self->senders, timeout);
+    }
+    return result;
+}
 
-    // Si falla es porque la cola esta vacia y estamos en una interupcion
-    if (!result) {
-        void* location = GetElementAddress(self, self->index_take);
-        memcpy(data, location, self->data_size);
-        self->index_take = (self->index_take + 1) % self->data_count;
+void QueueCommit(eos_queue_t self, void* element)
+{
+    uint32_t index = (self->index_give + self->data_count - self->pending - 1) % self->data_count;
 
-        EosSemaphoreGive(self->full);
+    // Solo se acepta el elemento reservado, se publica junto con los agregados mientras tanto
+    if (self->reserved && element == GetElementAddress(self, index)) {
+        self->reserved = false;
+        self->count += self->pending + 1;
+        self->pending = 0;
+        TRACE_EVENT(TRACE_QUEUE_GIVE, self - instances);
+        WakeupReceivers(self);
+
+        // Las tareas que esperaban a que se confirme la reserva anterior ya pueden reservar
+        WakeupSenders(self);
+    }
+}
+
+void* QueueAcquire(eos_queue_t self, uint32_t timeout)
+{
+    void* result = NULL;
+
+    if (!self->acquired && self->count > 0) {
+        self->count--;
+        self->acquired = true;
+        result = ConsumeElement(self);
+        TRACE_EVENT(TRACE_QUEUE_TAKE, self - instances);
+    } else if (!HandlerActive() && timeout) {
+        // Con la cola vacia o con otro elemento sin liberar el elemento lo asigna la tarea que lo
+        // publique o que libere el elemento anterior antes del vencimiento
+        TRACE_EVENT(TRACE_QUEUE_BLOCK, self - instances);
+        TaskSetBuffer(TaskGetDescriptor(), NULL);
+        TaskWait(self->receivers, timeout);
     }
     return result;
 }
 
+void QueueRelease(eos_queue_t self, void* element)
+{
+    uint32_t index = (self->index_take + self->data_count - self->consumed) % self->data_count;
+
+    // Solo se acepta el elemento adquirido, se libera junto con los retirados mientras tanto
+    if (self->acquired && element == GetElementAddress(self, index)) {
+        self->acquired = false;
+        ReleaseElements(self);
+
+        // Las tareas que esperaban a que se libere el elemento anterior ya pueden adquirir
+        WakeupReceivers(self);
+    }
+}
+
 void QueueDestroy(eos_queue_t self)
 {
     // Se libera la memoria ocupada por la instancia de la cola
@@ -38,6 +38,26 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|  26 | 2026.10.16 | evolentini      | Exclusion de interrupciones en servicios desde handlers |
+ **|  25 | 2026.10.16 | evolentini      | Tamano de pila por tarea y pilas suministradas          |
+ **|  24 | 2026.10.16 | evolentini      | Uso maximo de pila y deteccion de desbordes             |
+ **|  23 | 2026.10.16 | evolentini      | Histogramas de latencias de activacion por interrupcion |
+ **|  22 | 2026.10.16 | evolentini      | Estadisticas de uso del procesador por tarea e IRQ      |
+ **|  21 | 2026.10.16 | evolentini      | Particiones de tiempo con un planificador cada una      |
+ **|  20 | 2026.10.16 | evolentini      | Presupuesto de ciclos de ejecucion de las tareas        |
+ **|  19 | 2026.10.16 | evolentini      | Tareas periodicas y esperas hasta un tick absoluto      |
+ **|  18 | 2026.10.16 | evolentini      | Planificador por vencimiento del plazo mas proximo      |
+ **|  17 | 2026.10.16 | evolentini      | Umbral de desalojo de las tareas                        |
+ **|  16 | 2026.10.16 | evolentini      | Cambio de prioridad de las tareas en ejecucion          |
+ **|  15 | 2026.10.16 | evolentini      | Mutex con techo de prioridad inmediato                  |
+ **|  14 | 2026.10.16 | evolentini      | Mutex con herencia de prioridades                       |
+ **|  13 | 2026.10.16 | evolentini      | Grupos de bloques de memoria de tamaño fijo             |
+ **|  12 | 2026.10.16 | evolentini      | Reserva y adquisicion de elementos sin copia en colas   |
+ **|  11 | 2026.10.16 | evolentini      | Flujos de datos con un productor y un consumidor        |
+ **|  10 | 2026.10.16 | evolentini      | Colas como objetos del nucleo con un unico servicio     |
+ **|   9 | 2026.10.16 | evolentini      | Tiempo maximo de espera en semaforos y colas            |
+ **|   8 | 2026.10.16 | evolentini      | Modo sin ticks cuando solo se ejecuta la tarea inactiva |
+ **|   7 | 2026.10.16 | evolentini      | Reparto del procesador entre tareas de igual prioridad  |
  **|   6 | 2021.08.16 | evolentini      | Se mejora las notificaciones al usuario                 |
  **|   5 | 2021.08.16 | evolentini      | Se incluye una funcion para ceder el procesador         |
  **|   4 | 2021.08.15 | evolentini      | Se incluyen los handlers de interrupciones              |
@@ -54,6 +74,9 @@
 #include "semaforos.h"
 #include "tareas.h"
 #include "colas.h"
+#include "flujos.h"
+#include "memoria.h"
+#include "mutex.h"
 #include "interrupciones.h"
 #include <stddef.h>
 
@@ -63,17 +86,80 @@
 
 /* === Declaraciones de funciones internas ===================================================== */
 
+/**
+ * @brief Función para solicitar un servicio al sistema operativo desde una tarea
+ *
+ * @remark Por la convención de llamadas los argumentos ya se encuentran en los registros r0 a r3
+ * que lee el handler de la excepción SVC, el cual devuelve el resultado del servicio en r0.
+ *
+ * @param[in] service   Servicio del sistema operativo que se solicita
+ * @param[in] first     Primer parametro del servicio
+ * @param[in] second    Segundo parametro del servicio
+ * @param[in] third     Tercer parametro del servicio
+ * @return              Resultado devuelto por el servicio
+ */
+__attribute__((naked())) static uint32_t ServiceCall(
+    eos_services_t service, uint32_t first, uint32_t second, uint32_t third);
+
 /* === Definiciones de variables internas ====================================================== */
 
 /* === Definiciones de variables externas ====================================================== */
 
 /* === Definiciones de funciones internas ====================================================== */
 
+__attribute__((naked())) static uint32_t ServiceCall(
+    eos_services_t service, uint32_t first, uint32_t second, uint32_t third)
+{
+    __asm__ volatile("svc #0");
+    __asm__ volatile("bx lr");
+}
+
 /* === Definiciones de funciones externas ====================================================== */
 eos_task_t EosTaskCreate(eos_entry_point_t entry_point, void* data, uint8_t priority)
 {
-    // Llama a la función privada para crear una tarea
-    eos_task_t result = TaskCreate(entry_point, data, priority);
+    eos_task_t result = NULL;
+
+    // Llama a la función privada para crear una tarea si la prioridad es valida
+    if (priority < EOS_MAX_PRIORITY) {
+        result = TaskCreate(entry_point, data, priority);
+    }
+
+    // Notifica del error al usuario si corresponde
+    if (!result) {
+        EosOnErrorCallback(EOS_ERRROR_CREATING_TASK);
+    }
+
+    return result;
+}
+
+eos_task_t EosTaskCreateStack(
+    eos_entry_point_t entry_point, void* data, uint8_t priority, void* stack, uint16_t size)
+{
+    eos_task_t result = NULL;
+
+    // Llama a la función privada si la prioridad, el tamaño y la alineación de la pila son validos
+    if (priority < EOS_MAX_PRIORITY && size >= EOS_MIN_STACK_SIZE
+        && ((uintptr_t)stack & 0x07) == 0) {
+        result = TaskCreateStack(entry_point, data, priority, stack, size);
+    }
+
+    // Notifica del error al usuario si corresponde
+    if (!result) {
+        EosOnErrorCallback(EOS_ERRROR_CREATING_TASK);
+    }
+
+    return result;
+}
+
+eos_task_t EosTaskCreatePeriodic(eos_entry_point_t entry_point, void* data, uint8_t priority,
+    uint32_t period, uint32_t deadline)
+{
+    eos_task_t result = NULL;
+
+    // Llama a la función privada para crear una tarea si la prioridad y el periodo son validos
+    if (priority < EOS_MAX_PRIORITY && period > 0) {
+        result = TaskCreatePeriodic(entry_point, data, priority, period, deadline);
+    }
 
     // Notifica del error al usuario si corresponde
     if (!result) {
@@ -83,6 +169,36 @@ eos_task_t EosTaskCreate(eos_entry_point_t entry_point, void* data, uint8_t prio
     return result;
 }
 
+uint32_t EosTaskDeadlineMisses(eos_task_t task)
+{
+    // Llama a la función privada
+    return TaskDeadlineMisses(task);
+}
+
+void EosTaskSetPartition(eos_task_t task, uint8_t partition)
+{
+    // Llama a la función privada y notifica del error al usuario si corresponde
+    if (partition >= EOS_MAX_PARTITIONS || !TaskSetPartition(task, partition)) {
+        EosOnErrorCallback(EOS_ERRROR_PARTITION);
+    }
+}
+
+void EosPartitionSchedule(eos_window_t windows, uint8_t count)
+{
+    bool valid = (count > 0);
+
+    for (uint8_t index = 0; index < count; index++) {
+        if (windows[index].partition >= EOS_MAX_PARTITIONS || windows[index].ticks == 0) {
+            valid = false;
+        }
+    }
+
+    // Llama a la función privada y notifica del error al usuario si corresponde
+    if (!valid || !TaskPartitionSchedule(windows, count)) {
+        EosOnErrorCallback(EOS_ERRROR_PARTITION);
+    }
+}
+
 void EosStartScheduler(void)
 {
     // Llama a la función privada para iniciar el planificador
@@ -92,24 +208,143 @@ void EosStartScheduler(void)
 void EosWaitDelay(uint32_t delay)
 {
     if (!HandlerActive()) {
-        __asm__ volatile("mov r1, %0" : : "r"(delay));
-        __asm__ volatile("mov r0, %0" : : "I"(EOS_SERVICE_DELAY));
-        __asm__ volatile("svc #0");
+        ServiceCall(EOS_SERVICE_DELAY, delay, 0, 0);
+    } else {
+        EosOnErrorCallback(EOS_ERRROR_DELAY_IN_HANDLER);
+    }
+}
+
+void EosWaitUntil(uint32_t* last_wake, uint32_t period)
+{
+    if (!HandlerActive()) {
+        // El tick se compara en el servicio para que no cambie entre el calculo y la espera
+        *last_wake += period;
+        ServiceCall(EOS_SERVICE_WAIT_UNTIL, *last_wake, 0, 0);
     } else {
         EosOnErrorCallback(EOS_ERRROR_DELAY_IN_HANDLER);
     }
 }
 
+uint32_t EosTickCount(void)
+{
+    // Llama a la función privada
+    return TaskTickCount();
+}
+
 void EosCpuYield(void)
 {
     if (!HandlerActive()) {
-        __asm__ volatile("mov r0, %0" : : "I"(EOS_SERVICE_YIELD));
-        __asm__ volatile("svc #0");
+        ServiceCall(EOS_SERVICE_YIELD, 0, 0, 0);
     } else {
         EosOnErrorCallback(EOS_ERRROR_YIELD_IN_HANDLER);
     }
 }
 
+void EosTaskSetTimeSlice(eos_task_t task, uint32_t ticks)
+{
+    // Llama a la función privada
+    TaskSetTimeSlice(task, ticks);
+}
+
+void EosTaskSetPriority(eos_task_t task, uint8_t priority)
+{
+    if (priority >= EOS_MAX_PRIORITY) {
+        EosOnErrorCallback(EOS_ERRROR_TASK_PRIORITY);
+    } else if (HandlerActive()) {
+        // La tarea y los dueños de la cadena de mutex cambian de cola sin que otra interrupción
+        // modifique las listas de tareas
+        __asm__ volatile("cpsid i");
+        MutexSetBasePriority(task, priority);
+        __asm__ volatile("cpsie i");
+    } else {
+        ServiceCall(EOS_SERVICE_TASK_PRIORITY, (uint32_t)task, priority, 0);
+    }
+}
+
+void EosTaskSetDeadline(eos_task_t task, uint32_t ticks)
+{
+    // La tarea se reubica en el planificador sin que otra interrupción modifique las listas
+    __asm__ volatile("cpsid i");
+    TaskSetDeadline(task, ticks);
+    __asm__ volatile("cpsie i");
+}
+
+#if EOS_TASK_BUDGET
+void EosTaskSetBudget(eos_task_t task, uint32_t cycles, uint32_t period)
+{
+    // Llama a la función privada
+    TaskSetBudget(task, cycles, period);
+}
+#endif
+
+#if EOS_TASK_STATS
+void EosTaskGetStats(eos_task_t task, eos_stats_t stats)
+{
+    if (HandlerActive()) {
+        // Una interrupción de mayor prioridad no puede modificar los acumuladores durante la copia
+        __asm__ volatile("cpsid i");
+        TaskGetStats(task, stats);
+        __asm__ volatile("cpsie i");
+    } else {
+        ServiceCall(EOS_SERVICE_TASK_STATS, (uint32_t)task, (uint32_t)stats, 0);
+    }
+}
+
+void EosHandlerGetStats(uint8_t service, eos_stats_t stats)
+{
+    if (HandlerActive()) {
+        // Una interrupción de mayor prioridad no puede modificar los acumuladores durante la copia
+        __asm__ volatile("cpsid i");
+        HandlerGetStats(service, stats);
+        __asm__ volatile("cpsie i");
+    } else {
+        ServiceCall(EOS_SERVICE_HANDLER_STATS, service, (uint32_t)stats, 0);
+    }
+}
+#endif
+
+#if EOS_LATENCY
+void EosHandlerGetLatency(uint8_t service, uint32_t* histogram, bool reset)
+{
+    if (HandlerActive()) {
+        // Una interrupción de mayor prioridad no puede registrar latencias durante la copia
+        __asm__ volatile("cpsid i");
+        HandlerGetLatency(service, histogram, reset);
+        __asm__ volatile("cpsie i");
+    } else {
+        ServiceCall(EOS_SERVICE_HANDLER_LATENCY, service, (uint32_t)histogram, reset);
+    }
+}
+#endif
+
+void EosTaskSetPreemptionThreshold(eos_task_t task, uint8_t threshold)
+{
+    if (threshold >= EOS_MAX_PRIORITY) {
+        EosOnErrorCallback(EOS_ERRROR_TASK_PRIORITY);
+    } else if (HandlerActive()) {
+        // El umbral y el pedido de replanificación se fijan sin que otra interrupción lo cambie
+        __asm__ volatile("cpsid i");
+        TaskSetThreshold(task, threshold);
+        __asm__ volatile("cpsie i");
+    } else {
+        ServiceCall(EOS_SERVICE_TASK_THRESHOLD, (uint32_t)task, threshold, 0);
+    }
+}
+
+uint8_t EosTaskGetPriority(eos_task_t task)
+{
+    // Llama a la función privada
+    return TaskGetBasePriority(task);
+}
+
+#if EOS_STACK_CHECK
+uint16_t EosTaskStackHighWater(eos_task_t task)
+{
+    // Llama a la función privada
+    return TaskStackHighWater(task);
+}
+#endif
+
 eos_semaphore_t EosSemaphoreCreate(int32_t initial_value)
 {
     // Llama a la función privada para crear un semaforo
@@ -126,28 +361,36 @@ eos_semaphore_t EosSemaphoreCreate(int32_t initial_value)
 void EosSemaphoreGive(eos_semaphore_t self)
 {
     if (HandlerActive()) {
+        // Una interrupción de mayor prioridad no puede modificar las listas de tareas ni las
+        // esperas temporizadas mientras se despierta la tarea que esperaba el semaforo
+        __asm__ volatile("cpsid i");
         SemaphoreGive(self);
+        __asm__ volatile("cpsie i");
     } else {
-        __asm__ volatile("mov r1, %0" : : "r"(self));
-        __asm__ volatile("mov r0, %0" : : "I"(EOS_SERVICE_GIVE));
-        __asm__ volatile("svc #0");
+        ServiceCall(EOS_SERVICE_GIVE, (uint32_t)self, 0, 0);
     }
 }
 
 bool EosSemaphoreTake(eos_semaphore_t self)
 {
-    static bool resultado;
+    // Llama a la versión temporizada con una espera sin limite
+    return EosSemaphoreTakeTimeout(self, EOS_WAIT_FOREVER);
+}
+
+bool EosSemaphoreTakeTimeout(eos_semaphore_t self, uint32_t timeout)
+{
+    bool resultado;
 
     if (HandlerActive()) {
-        resultado = SemaphoreTake(self);
+        // En un handler de interrupcion no se puede esperar, el fallo se notifica como error
+        __asm__ volatile("cpsid i");
+        resultado = SemaphoreTake(self, 0);
+        __asm__ volatile("cpsie i");
+        if (!resultado) {
+            EosOnErrorCallback(EOS_ERRROR_TAKING_SEMAPHORE);
+        }
     } else {
-        __asm__ volatile("mov r1, %0" : : "r"(self));
-        __asm__ volatile("mov r0, %0" : : "I"(EOS_SERVICE_TAKE));
-        __asm__ volatile("svc #0");
-        __asm__ volatile("str r0, %0" : "=m"(resultado));
-    }
-    if (!resultado) {
-        EosOnErrorCallback(EOS_ERRROR_TAKING_SEMAPHORE);
+        resultado = ServiceCall(EOS_SERVICE_TAKE, (uint32_t)self, timeout, 0);
     }
     return resultado;
 }
@@ -167,14 +410,266 @@ eos_queue_t EosQueueCreate(void* data, uint32_t count, uint32_t size)
 
 bool EosQueueGive(eos_queue_t queue, void* data)
 {
-    // Llama a la función privada
-    return QueueGive(queue, data);
+    // Llama a la versión temporizada con una espera sin limite
+    return EosQueueGiveTimeout(queue, data, EOS_WAIT_FOREVER);
+}
+
+bool EosQueueGiveTimeout(eos_queue_t queue, void* data, uint32_t timeout)
+{
+    bool resultado;
+
+    if (HandlerActive()) {
+        // En un handler de interrupcion no se puede esperar un lugar libre y mientras se despierta
+        // al receptor otra interrupción no puede modificar la cola ni las listas de tareas
+        __asm__ volatile("cpsid i");
+        resultado = QueueGive(queue, data, 0);
+        __asm__ volatile("cpsie i");
+    } else {
+        resultado = ServiceCall(EOS_SERVICE_QUEUE_GIVE, (uint32_t)queue, (uint32_t)data, timeout);
+    }
+    return resultado;
 }
 
 bool EosQueueTake(eos_queue_t queue, void* data)
 {
-    // Llama a la función privada
-    return QueueTake(queue, data);
+    // Llama a la versión temporizada con una espera sin limite
+    return EosQueueTakeTimeout(queue, data, EOS_WAIT_FOREVER);
+}
+
+bool EosQueueTakeTimeout(eos_queue_t queue, void* data, uint32_t timeout)
+{
+    bool resultado;
+
+    if (HandlerActive()) {
+        // En un handler de interrupcion no se puede esperar un dato y el lugar liberado se entrega
+        // a la tarea que esperaba sin que otra interrupción modifique la cola
+        __asm__ volatile("cpsid i");
+        resultado = QueueTake(queue, data, 0);
+        __asm__ volatile("cpsie i");
+    } else {
+        resultado = ServiceCall(EOS_SERVICE_QUEUE_TAKE, (uint32_t)queue, (uint32_t)data, timeout);
+    }
+    return resultado;
+}
+
+void* EosQueueReserve(eos_queue_t queue)
+{
+    // Llama a la versión temporizada con una espera sin limite
+    return EosQueueReserveTimeout(queue, EOS_WAIT_FOREVER);
+}
+
+void* EosQueueReserveTimeout(eos_queue_t queue, uint32_t timeout)
+{
+    void* resultado;
+
+    if (HandlerActive()) {
+        // En un handler de interrupcion no se puede esperar un lugar libre
+        __asm__ volatile("cpsid i");
+        resultado = QueueReserve(queue, 0);
+        __asm__ volatile("cpsie i");
+    } else {
+        resultado = (void*)ServiceCall(EOS_SERVICE_QUEUE_RESERVE, (uint32_t)queue, timeout, 0);
+    }
+    return resultado;
+}
+
+void EosQueueCommit(eos_queue_t queue, void* element)
+{
+    if (HandlerActive()) {
+        // Al publicar el elemento se pueden despertar tareas, lo que no admite otra interrupción
+        __asm__ volatile("cpsid i");
+        QueueCommit(queue, element);
+        __asm__ volatile("cpsie i");
+    } else {
+        ServiceCall(EOS_SERVICE_QUEUE_COMMIT, (uint32_t)queue, (uint32_t)element, 0);
+    }
+}
+
+void* EosQueueAcquire(eos_queue_t queue)
+{
+    // Llama a la versión temporizada con una espera sin limite
+    return EosQueueAcquireTimeout(queue, EOS_WAIT_FOREVER);
+}
+
+void* EosQueueAcquireTimeout(eos_queue_t queue, uint32_t timeout)
+{
+    void* resultado;
+
+    if (HandlerActive()) {
+        // En un handler de interrupcion no se puede esperar un dato
+        __asm__ volatile("cpsid i");
+        resultado = QueueAcquire(queue, 0);
+        __asm__ volatile("cpsie i");
+    } else {
+        resultado = (void*)ServiceCall(EOS_SERVICE_QUEUE_ACQUIRE, (uint32_t)queue, timeout, 0);
+    }
+    return resultado;
+}
+
+void EosQueueRelease(eos_queue_t queue, void* element)
+{
+    if (HandlerActive()) {
+        // El lugar liberado se entrega a las tareas que esperaban sin que otra interrupción
+        // modifique la cola o las listas de tareas
+        __asm__ volatile("cpsid i");
+        QueueRelease(queue, element);
+        __asm__ volatile("cpsie i");
+    } else {
+        ServiceCall(EOS_SERVICE_QUEUE_RELEASE, (uint32_t)queue, (uint32_t)element, 0);
+    }
+}
+
+eos_stream_t EosStreamCreate(void* data, uint32_t count, uint32_t size)
+{
+    // Llama a la función privada para crear el flujo
+    eos_stream_t result = StreamCreate(data, count, size);
+
+    // Notifica del error al usuario si corresponde
+    if (!result) {
+        EosOnErrorCallback(EOS_ERRROR_CREATING_STREAM);
+    }
+
+    return result;
+}
+
+bool EosStreamWrite(eos_stream_t stream, void const* data)
+{
+    bool resultado = StreamWrite(stream, data);
+
+    // Solo se llama al sistema operativo si el consumidor espera con el flujo vacio
+    if (resultado && StreamWaiting(stream)) {
+        if (HandlerActive()) {
+            // El consumidor se despierta sin que otra interrupción modifique las listas de tareas
+            __asm__ volatile("cpsid i");
+            StreamWakeup(stream);
+            __asm__ volatile("cpsie i");
+        } else {
+            ServiceCall(EOS_SERVICE_STREAM_WAKEUP, (uint32_t)stream, 0, 0);
+        }
+    }
+    return resultado;
+}
+
+bool EosStreamRead(eos_stream_t stream, void* data)
+{
+    // Llama a la versión temporizada con una espera sin limite
+    return EosStreamReadTimeout(stream, data, EOS_WAIT_FOREVER);
+}
+
+bool EosStreamReadTimeout(eos_stream_t stream, void* data, uint32_t timeout)
+{
+    bool resultado = StreamRead(stream, data);
+
+    // Con el flujo vacio la tarea se bloquea hasta que el productor agregue un dato
+    if (!resultado && timeout && !HandlerActive()) {
+        if (ServiceCall(EOS_SERVICE_STREAM_WAIT, (uint32_t)stream, timeout, 0)) {
+            resultado = StreamRead(stream, data);
+        }
+    }
+    return resultado;
+}
+
+eos_pool_t EosPoolCreate(void* storage, uint32_t size, uint32_t count)
+{
+    // Llama a la función privada para crear el grupo de bloques
+    eos_pool_t result = PoolCreate(storage, size, count);
+
+    // Notifica del error al usuario si corresponde
+    if (!result) {
+        EosOnErrorCallback(EOS_ERRROR_CREATING_POOL);
+    }
+
+    return result;
+}
+
+void* EosPoolAllocate(eos_pool_t pool)
+{
+    // Llama a la versión temporizada con una espera sin limite
+    return EosPoolAllocateTimeout(pool, EOS_WAIT_FOREVER);
+}
+
+void* EosPoolAllocateTimeout(eos_pool_t pool, uint32_t timeout)
+{
+    void* resultado;
+
+    if (HandlerActive()) {
+        // Una interrupción de mayor prioridad no puede modificar la lista de bloques libres
+        __asm__ volatile("cpsid i");
+        resultado = PoolAllocate(pool, 0);
+        __asm__ volatile("cpsie i");
+    } else {
+        resultado = (void*)ServiceCall(EOS_SERVICE_POOL_ALLOCATE, (uint32_t)pool, timeout, 0);
+    }
+    return resultado;
+}
+
+void EosPoolFree(eos_pool_t pool, void* block)
+{
+    if (HandlerActive()) {
+        // Una interrupción de mayor prioridad no puede modificar la lista de bloques libres
+        __asm__ volatile("cpsid i");
+        PoolFree(pool, block);
+        __asm__ volatile("cpsie i");
+    } else {
+        ServiceCall(EOS_SERVICE_POOL_FREE, (uint32_t)pool, (uint32_t)block, 0);
+    }
+}
+
+eos_mutex_t EosMutexCreate(void)
+{
+    // Llama a la función privada para crear el mutex
+    eos_mutex_t result = MutexCreate(0);
+
+    // Notifica del error al usuario si corresponde
+    if (!result) {
+        EosOnErrorCallback(EOS_ERRROR_CREATING_MUTEX);
+    }
+
+    return result;
+}
+
+eos_mutex_t EosMutexCreateCeiling(uint8_t ceiling)
+{
+    eos_mutex_t result = NULL;
+
+    // Llama a la función privada para crear el mutex si el techo es una prioridad valida
+    if (ceiling < EOS_MAX_PRIORITY) {
+        result = MutexCreate(ceiling);
+    }
+
+    // Notifica del error al usuario si corresponde
+    if (!result) {
+        EosOnErrorCallback(EOS_ERRROR_CREATING_MUTEX);
+    }
+
+    return result;
+}
+
+bool EosMutexLock(eos_mutex_t mutex)
+{
+    // Llama a la versión temporizada con una espera sin limite
+    return EosMutexLockTimeout(mutex, EOS_WAIT_FOREVER);
+}
+
+bool EosMutexLockTimeout(eos_mutex_t mutex, uint32_t timeout)
+{
+    bool resultado = false;
+
+    if (!HandlerActive()) {
+        resultado = ServiceCall(EOS_SERVICE_MUTEX_LOCK, (uint32_t)mutex, timeout, 0);
+    } else {
+        EosOnErrorCallback(EOS_ERRROR_MUTEX_IN_HANDLER);
+    }
+    return resultado;
+}
+
+void EosMutexUnlock(eos_mutex_t mutex)
+{
+    if (HandlerActive()) {
+        EosOnErrorCallback(EOS_ERRROR_MUTEX_IN_HANDLER);
+    } else if (!ServiceCall(EOS_SERVICE_MUTEX_UNLOCK, (uint32_t)mutex, 0, 0)) {
+        EosOnErrorCallback(EOS_ERRROR_MUTEX_NOT_OWNER);
+    }
 }
 
 void EosHandlerInstall(
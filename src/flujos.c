@@ -0,0 +1,245 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file flujos.c
+ ** @brief Implementación de las funciones privadas para la gestion de flujos de datos
+ **
+ ** Un flujo es un buffer circular con un unico productor y un unico consumidor. La capacidad es
+ ** una potencia de dos y los indices de ingreso y salida avanzan libremente, por lo que la
+ ** posición se obtiene con una mascara y la cantidad de datos con una resta. Cada indice lo
+ ** modifica solo uno de los extremos, de manera que agregar y retirar datos no requiere llamar al
+ ** sistema operativo, solo se lo llama para bloquear al consumidor con el flujo vacio y para
+ ** despertarlo con el primer dato.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "flujos.h"
+#include "tareas.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Definiciones y Macros =================================================================== */
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Estructura de datos con la información de un flujo de datos
+struct eos_stream_s {
+    //! Puntero al bloque de datos donde se almacenan los elementos
+    uint32_t* data;
+    //! Mascara para obtener la posición en el bloque a partir de un indice
+    uint32_t mask;
+    //! Tamaño en palabras de cada elemento almacenado
+    uint32_t words;
+    //! Indice libre del siguiente dato a ingresar, solo lo modifica el productor
+    uint32_t head;
+    //! Indice libre del siguiente dato a retirar, solo lo modifica el consumidor
+    uint32_t tail;
+    //! Lista con la tarea consumidora cuando espera datos con el flujo vacio
+    struct task_list_s reader[1];
+};
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/**
+ * @brief Busca y asigna un desciptor para un nuevo flujo
+ */
+static eos_stream_t AllocateDescriptor(void);
+
+/**
+ * @brief Devuelve la dirección de un elemento del bloque de datos
+ *
+ * @param stream    Puntero al descriptor del flujo de datos
+ * @param index     Indice libre del elemento que se desea acceder
+ * @return          Dirección de memoria del elemento solicitado
+ */
+static uint32_t* GetElementAddress(eos_stream_t self, uint32_t index);
+
+/**
+ * @brief Copia un elemento palabra por palabra
+ *
+ * @param destination   Puntero al bloque donde se copia el elemento
+ * @param source        Puntero al bloque con el elemento a copiar
+ * @param words         Cantidad de palabras del elemento
+ */
+static void CopyElement(uint32_t* destination, uint32_t const* source, uint32_t words);
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Variable local con el almacenamiento de las instancias de los flujos
+static struct eos_stream_s instances[EOS_MAX_STREAMS] = { 0 };
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static eos_stream_t AllocateDescriptor(void)
+{
+    // Variable con el resultado del descriptor de flujo asignado
+    eos_stream_t self = NULL;
+
+    for (int index = 0; index < EOS_MAX_STREAMS; index++) {
+        if (instances[index].data == NULL) {
+            self = &(instances[index]);
+            break;
+        }
+    }
+    return self;
+}
+
+static uint32_t* GetElementAddress(eos_stream_t self, uint32_t index)
+{
+    return self->data + (index & self->mask) * self->words;
+}
+
+static void CopyElement(uint32_t* destination, uint32_t const* source, uint32_t words)
+{
+    while (words--) {
+        *(destination++) = *(source++);
+    }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+uint32_t StreamAvaiables(void)
+{
+    uint32_t result = 0;
+
+    for (int index = 0; index < EOS_MAX_STREAMS; index++) {
+        if (instances[index].data == NULL) {
+            result++;
+        }
+    }
+    return result;
+}
+
+eos_stream_t StreamCreate(void* data, uint32_t data_count, uint32_t data_size)
+{
+    eos_stream_t self = NULL;
+
+    // La capacidad debe ser potencia de dos y los elementos palabras completas y alineadas
+    if (data && data_count && data_size && !(data_count & (data_count - 1))
+        && !(data_size & 0x03) && !((uintptr_t)data & 0x03)) {
+        self = AllocateDescriptor();
+    }
+
+    if (self) {
+        self->data = data;
+        self->mask = data_count - 1;
+        self->words = data_size / sizeof(uint32_t);
+        self->head = 0;
+        self->tail = 0;
+        self->reader->first = NULL;
+        self->reader->last = NULL;
+    }
+    return self;
+}
+
+bool StreamWrite(eos_stream_t self, void const* const data)
+{
+    uint32_t head = self->head;
+    uint32_t tail = __atomic_load_n(&self->tail, __ATOMIC_RELAXED);
+    bool result = (head - tail) <= self->mask;
+
+    if (result) {
+        CopyElement(GetElementAddress(self, head), data, self->words);
+
+        // El procesador tiene un unico nucleo, solo se impide que el compilador publique el
+        // nuevo indice antes de terminar la copia del dato
+        __atomic_signal_fence(__ATOMIC_RELEASE);
+        __atomic_store_n(&self->head, head + 1, __ATOMIC_RELAXED);
+    }
+    return result;
+}
+
+bool StreamRead(eos_stream_t self, void* const data)
+{
+    uint32_t tail = self->tail;
+    uint32_t head = __atomic_load_n(&self->head, __ATOMIC_RELAXED);
+    bool result = (head != tail);
+
+    if (result) {
+        __atomic_signal_fence(__ATOMIC_ACQUIRE);
+        CopyElement(data, GetElementAddress(self, tail), self->words);
+
+        // El lugar se libera para el productor solo despues de terminar la copia del dato
+        __atomic_signal_fence(__ATOMIC_RELEASE);
+        __atomic_store_n(&self->tail, tail + 1, __ATOMIC_RELAXED);
+    }
+    return result;
+}
+
+bool StreamWaiting(eos_stream_t self)
+{
+    // El consumidor se registra antes de que el productor lea la lista o ve el dato agregado
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    return __atomic_load_n(&self->reader->first, __ATOMIC_RELAXED) != NULL;
+}
+
+bool StreamWait(eos_stream_t self, uint32_t timeout)
+{
+    bool result = (self->head != self->tail);
+
+    if (!result && timeout) {
+        TaskWait(self->reader, timeout);
+    }
+    return result;
+}
+
+void StreamWakeup(eos_stream_t self)
+{
+    eos_task_t task = self->reader->first;
+
+    if (task) {
+        TaskWakeup(task, true);
+    }
+}
+
+void StreamDestroy(eos_stream_t self)
+{
+    // Se libera la memoria ocupada por la instancia del flujo
+    memset(self, 0, sizeof(struct eos_stream_s));
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
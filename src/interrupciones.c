@@ -38,6 +38,11 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   6 | 2026.10.16 | evolentini      | Espera sin ticks solo con la opcion habilitada          |
+ **|   5 | 2026.10.16 | evolentini      | Histogramas de latencias de activacion por interrupcion |
+ **|   4 | 2026.10.16 | evolentini      | Registro de eventos del nucleo en memoria               |
+ **|   3 | 2026.10.16 | evolentini      | Estadisticas de uso del procesador por tarea e IRQ      |
+ **|   2 | 2026.10.16 | evolentini      | Modo sin ticks cuando solo se ejecuta la tarea inactiva |
  **|   1 | 2021.08.15 | evolentini      | Version inicial del archivo                             |
  **
  ** @addtogroup eos
@@ -47,9 +52,12 @@
 /* === Inclusiones de cabeceras ================================================================ */
 
 #include "interrupciones.h"
+#include "tareas.h"
+#include "traza.h"
 #include "sapi.h"
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 /* === Definiciones y Macros =================================================================== */
 
@@ -64,6 +72,18 @@ typedef struct handler_s {
     eos_entry_point_t entry_point;
     //! Puntero a un bloque de datos que se envia como parametro al handler
     void* data;
+#if EOS_TASK_STATS
+    //! Cantidad de ciclos ejecutados por el handler
+    uint64_t cycles;
+    //! Cantidad de veces que se atendió la interrupción
+    uint32_t count;
+#endif
+#if EOS_LATENCY
+    //! Valor del contador de ciclos al entrar a la atención en curso de la interrupción
+    uint32_t entry;
+    //! Histograma de las latencias de activación de las tareas despertadas por la interrupción
+    uint32_t latency[EOS_LATENCY_BUCKETS];
+#endif
 } * handler_t;
 
 /* === Declaraciones de funciones internas ===================================================== */
@@ -90,6 +110,11 @@ static struct handler_s handlers[HANDLERS_COUNT] = { 0 };
 //! Cantidad de handler activos atendiendo interrupciones anidadas
 static int handler_actives = 0;
 
+#if EOS_LATENCY
+//! Puntero al handler de la interrupción anidada mas reciente o NULL si no hay ninguna en curso
+static handler_t handler_current = NULL;
+#endif
+
 /* === Definiciones de variables externas ====================================================== */
 
 /* === Definiciones de funciones internas ====================================================== */
@@ -105,17 +130,50 @@ static handler_t GetHandler(uint8_t service)
 
 void InterruptHandler(uint8_t service)
 {
+#if EOS_LATENCY
+    // El contador se lee antes que cualquier otra acción para medir la latencia completa
+    uint32_t entry = DWT->CYCCNT;
+    handler_t interrupted;
+#endif
     handler_t handler = GetHandler(service);
+#if EOS_TASK_STATS
+    uint64_t* previous;
+#endif
+
     if (handler && handler->entry_point) {
+#if EOS_TICKLESS_IDLE
+        // Se corrige la cuenta de ticks si el procesador estaba en una espera sin ticks
+        TicklessWakeup();
+#endif
+        TRACE_EVENT(TRACE_HANDLER_ENTER, service);
+
         __asm__ volatile("cpsid i");
         handler_actives++;
+#if EOS_TASK_STATS
+        // Desde aqui los ciclos se cargan al handler y no a la tarea o handler interrumpido
+        previous = TaskStatsHandler(&handler->cycles);
+        handler->count++;
+#endif
+#if EOS_LATENCY
+        interrupted = handler_current;
+        handler->entry = entry;
+        handler_current = handler;
+#endif
         __asm__ volatile("cpsie i");
 
         handler->entry_point(handler->data);
 
         __asm__ volatile("cpsid i");
         handler_actives--;
+#if EOS_TASK_STATS
+        TaskStatsHandler(previous);
+#endif
+#if EOS_LATENCY
+        handler_current = interrupted;
+#endif
         __asm__ volatile("cpsie i");
+
+        TRACE_EVENT(TRACE_HANDLER_EXIT, service);
     }
 }
 
@@ -202,6 +260,68 @@ void HandlerRemove(uint8_t service)
     }
 }
 
+#if EOS_TASK_STATS
+void HandlerGetStats(uint8_t service, eos_stats_t stats)
+{
+    handler_t handler = GetHandler(service);
+
+    stats->cycles = 0;
+    stats->switches = 0;
+    if (handler) {
+        stats->cycles = handler->cycles;
+        stats->switches = handler->count;
+    }
+    TaskStatsLoad(stats);
+}
+#endif
+
+#if EOS_LATENCY
+bool HandlerWakeupSource(uint8_t* service, uint32_t* entry)
+{
+    bool result = false;
+
+    if (handler_current) {
+        *service = (uint8_t)(handler_current - handlers);
+        *entry = handler_current->entry;
+        result = true;
+    }
+    return result;
+}
+
+void HandlerLatencyRecord(uint8_t service, uint32_t cycles)
+{
+    handler_t handler = GetHandler(service);
+    uint32_t bucket = 31 - __builtin_clz(cycles | 1);
+
+    if (handler) {
+        // El ultimo intervalo acumula todas las latencias que superan el rango del histograma
+        if (bucket >= EOS_LATENCY_BUCKETS) {
+            bucket = EOS_LATENCY_BUCKETS - 1;
+        }
+        if (handler->latency[bucket] < UINT32_MAX) {
+            handler->latency[bucket]++;
+        }
+    }
+}
+
+void HandlerGetLatency(uint8_t service, uint32_t* histogram, bool reset)
+{
+    handler_t handler = GetHandler(service);
+
+    if (histogram) {
+        memset(histogram, 0, sizeof(handler->latency));
+    }
+    if (handler) {
+        if (histogram) {
+            memcpy(histogram, handler->latency, sizeof(handler->latency));
+        }
+        if (reset) {
+            memset(handler->latency, 0, sizeof(handler->latency));
+        }
+    }
+}
+#endif
+
 /* === Ciere de documentacion ================================================================== */
 
 /** @} Final de la definición del modulo para doxygen */
@@ -38,6 +38,9 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|  19 | 2026.10.16 | evolentini      | Un flujo por cada handler productor de eventos          |
+ **|  18 | 2026.10.16 | evolentini      | Tareas periodicas y esperas hasta un tick absoluto      |
+ **|  17 | 2026.10.16 | evolentini      | Flujos de datos con un productor y un consumidor        |
  **|  16 | 2021.08.16 | evolentini      | Se cambia el programa para resolver el examen propuesto |
  **|  15 | 2021.08.15 | evolentini      | Se agrega un ejemplo de uso los handler de interrupcion |
  **|  14 | 2021.08.14 | evolentini      | Se agrega un ejemplo de uso de las colas de datos       |
@@ -70,10 +73,16 @@
 
 /* === Definiciones y Macros =================================================================== */
 
+//! Define la cantidad de teclas, cada una con su interrupción y su flujo de eventos
+#define TECLAS 2
+
+//! Define la cantidad máxima de elementos en el flujo de eventos de cada tecla, potencia de dos
+#define FLUJO_CANTIDAD 4
+
 //! Define la cantidad máxima de elementos en la cola de eventos de teclas
 #define TECLAS_CANTIDAD 4
 
-//! Define el tamaño de las entradas en la cola de eventos de teclas
+//! Define el tamaño de las entradas en los flujos y en la cola de eventos de teclas
 #define TECLAS_TAMANO sizeof(struct tecla_evento_s)
 
 //! Define la cantidad máxima de elementos en la cola de eventos de teclas
@@ -129,9 +138,21 @@ typedef struct color_evento_s {
     colores_t color;
 } * color_evento_t;
 
-//! Estructura de datos con las dos colas de datos para la tarea de procesamiento
+//! Estructura de datos con el handler y el flujo de eventos de una tecla
+typedef struct tecla_s {
+    //! Numero de canal de interupción GPIO de la tecla
+    uint8_t canal;
+    //! Valor del contador de reloj en el ultimo evento aceptado de la tecla
+    uint32_t ultimo_evento;
+    //! Flujo por el que el handler de la tecla, su unico productor, envia los eventos
+    eos_stream_t flujo;
+    //! Cola en la que se reunen los eventos de todas las teclas
+    eos_queue_t cola;
+} * tecla_t;
+
+//! Estructura de datos con las colas de datos para la tarea de procesamiento
 typedef struct colas_s {
-    //! Cola por la que se reciben los eventos de teclas de los handlers
+    //! Cola por la que se reciben los eventos de todas las teclas
     eos_queue_t cola_teclas;
     //! Cola por la se se envian los eventos de colores a la tarea de presentación
     eos_queue_t cola_colores;
@@ -156,12 +177,22 @@ void ConfigurarInterrupcion(uint8_t canal, uint8_t puerto, uint8_t terminal);
 void EosSysTickCallback(void);
 
 /**
- * @brief Handler para atender la interupcion de teclado
+ * @brief Handler para atender la interupcion de una tecla
  *
- * @param data Refecencia a la cola por la se que deben enviar los eventos
+ * @param data Puntero a la estructura de la tecla con el flujo por el que se envian los eventos
  */
 void EventoTecla(void* data);
 
+/**
+ * @brief Tarea que reenvia a la cola comun los eventos recibidos por el flujo de una tecla
+ *
+ * @remark Cada flujo admite un unico productor y un unico consumidor, por lo que cada tecla tiene
+ * su flujo y esta tarea es su consumidor. La cola si admite varios productores.
+ *
+ * @param data Puntero a la estructura de la tecla con el flujo y la cola de eventos
+ */
+void Teclado(void* data);
+
 /**
  * @brief Tarea para procesar los eventos de teclas y generar eventos de colores
  *
@@ -188,6 +219,9 @@ void Consola(void* data);
 //! Variable global con la cuanta de reloj
 static uint32_t tick_count = 0;
 
+//! Variable global para el almacenamiento de los flujos de cada tecla
+static struct tecla_evento_s vector_flujos[TECLAS][FLUJO_CANTIDAD] = { 0 };
+
 //! Variable global para el almacenamiento de la cola de teclas
 static struct tecla_evento_s vector_teclas[TECLAS_CANTIDAD] = { 0 };
 
@@ -215,27 +249,37 @@ void EosSysTickCallback(void) { tick_count++; }
 
 void EventoTecla(void* data)
 {
-    eos_queue_t cola = data;
+    tecla_t tecla = data;
     struct tecla_evento_s evento[1];
-    static uint32_t ultimo_evento[2] = { 0 };
-
-    for (int tecla = 0; tecla < 2; tecla++) {
-        bool presionada = (Chip_PININT_GetFallStates(LPC_GPIO_PIN_INT) & (1 << tecla));
-        bool liberada = (Chip_PININT_GetRiseStates(LPC_GPIO_PIN_INT) & (1 << tecla));
-        Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, 1 << tecla);
-
-        if (presionada && (tick_count - ultimo_evento[tecla] > 100)) {
-            ultimo_evento[tecla] = tick_count;
-            evento->accion = (tecla & 0x01) << 1;
-            evento->reloj = tick_count;
-            EosQueueGive(cola, evento);
-        }
-        if (liberada && (tick_count - ultimo_evento[tecla] > 100)) {
-            ultimo_evento[tecla] = tick_count;
-            evento->accion = ((tecla & 0x01) << 1) + 1;
-            evento->reloj = tick_count;
-            EosQueueGive(cola, evento);
-        }
+    uint32_t mascara = 1 << tecla->canal;
+
+    // Cada handler solo atiende su canal para ser el unico productor del flujo de la tecla
+    bool presionada = (Chip_PININT_GetFallStates(LPC_GPIO_PIN_INT) & mascara);
+    bool liberada = (Chip_PININT_GetRiseStates(LPC_GPIO_PIN_INT) & mascara);
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, mascara);
+
+    if (presionada && (tick_count - tecla->ultimo_evento > 100)) {
+        tecla->ultimo_evento = tick_count;
+        evento->accion = (tecla->canal & 0x01) << 1;
+        evento->reloj = tick_count;
+        EosStreamWrite(tecla->flujo, evento);
+    }
+    if (liberada && (tick_count - tecla->ultimo_evento > 100)) {
+        tecla->ultimo_evento = tick_count;
+        evento->accion = ((tecla->canal & 0x01) << 1) + 1;
+        evento->reloj = tick_count;
+        EosStreamWrite(tecla->flujo, evento);
+    }
+}
+
+void Teclado(void* data)
+{
+    tecla_t tecla = data;
+    struct tecla_evento_s evento[1];
+
+    while (true) {
+        EosStreamRead(tecla->flujo, evento);
+        EosQueueGive(tecla->cola, evento);
     }
 }
 
@@ -304,9 +348,11 @@ void Visualizacion(void* data)
 {
     eos_queue_t cola = data;
     struct color_evento_s evento[1];
+    uint32_t encendido;
 
     while (1) {
         EosQueueTake(cola, evento);
+        encendido = EosTickCount();
         switch (evento->color) {
         case COLOR_VERDE:
             gpioWrite(LED3, true);
@@ -321,7 +367,7 @@ void Visualizacion(void* data)
             gpioWrite(LEDB, true);
             break;
         }
-        EosWaitDelay(evento->t1 + evento->t2);
+        EosWaitUntil(&encendido, evento->t1 + evento->t2);
         switch (evento->color) {
         case COLOR_VERDE:
             gpioWrite(LED3, false);
@@ -378,6 +424,9 @@ int main(void)
     // Variable con las colas que se envian a la tarea de procesamiento
     static struct colas_s colas[1];
 
+    // Variable con los canales de interrupción y los flujos de cada tecla
+    static struct tecla_s teclas[TECLAS] = { { .canal = 0 }, { .canal = 1 } };
+
     // Configuración de los dispositivos de la placa
     boardConfig();
 
@@ -386,12 +435,20 @@ int main(void)
     colas->cola_colores = EosQueueCreate(vector_colores, COLORES_CANTIDAD, COLORES_TAMANO);
     colas->cola_mensajes = EosQueueCreate(vector_mensajes, MENSAJES_CANTIDAD, COLORES_TAMANO);
 
+    // Cada tecla envia sus eventos por su propio flujo a la tarea que los reenvia a la cola
+    for (int indice = 0; indice < TECLAS; indice++) {
+        tecla_t tecla = &teclas[indice];
+        tecla->flujo = EosStreamCreate(vector_flujos[indice], FLUJO_CANTIDAD, TECLAS_TAMANO);
+        tecla->cola = colas->cola_teclas;
+        EosTaskCreate(Teclado, tecla, 3);
+    }
+
     // Configuraicón de las interrupciones de teclado
     ConfigurarInterrupcion(0, 0, 4);
-    EosHandlerInstall(PIN_INT0_IRQn, 0, EventoTecla, colas->cola_teclas);
+    EosHandlerInstall(PIN_INT0_IRQn, 0, EventoTecla, &teclas[0]);
 
     ConfigurarInterrupcion(1, 0, 8);
-    EosHandlerInstall(PIN_INT1_IRQn, 0, EventoTecla, colas->cola_teclas);
+    EosHandlerInstall(PIN_INT1_IRQn, 0, EventoTecla, &teclas[1]);
 
     // Creación de la tarea que procesa los eventos de las teclas
     EosTaskCreate(Procesamiento, colas, 1);
@@ -0,0 +1,194 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @file memoria.c
+ ** @brief Implementación de las funciones privadas para la gestion de bloques de memoria
+ **
+ ** La memoria suministrada se divide en bloques de tamaño fijo y los bloques libres se enlazan
+ ** en una lista usando su primera palabra como puntero al siguiente, por lo que asignar y liberar
+ ** un bloque solo requiere retirarlo o agregarlo al inicio de la lista.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "memoria.h"
+#include "tareas.h"
+#include "interrupciones.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Definiciones y Macros =================================================================== */
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Estructura de un bloque de memoria mientras se encuentra libre
+typedef struct block_s {
+    //! Puntero al siguiente bloque libre
+    struct block_s* next;
+} * block_t;
+
+//! Estructura de datos con la información de un grupo de bloques de memoria
+struct eos_pool_s {
+    //! Puntero a la memoria que se divide en bloques
+    void* data;
+    //! Tamaño en bytes de cada bloque
+    uint32_t block_size;
+    //! Cantidad de bloques en los que se divide la memoria
+    uint32_t block_count;
+    //! Puntero al primer bloque de la lista de bloques libres
+    block_t free;
+    //! Lista de las tareas que esperan un bloque libre
+    struct task_list_s waiting[1];
+};
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/**
+ * @brief Busca y asigna un desciptor para un nuevo grupo de bloques
+ */
+static eos_pool_t AllocateDescriptor(void);
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Variable local con el almacenamiento de las instancias de los grupos de bloques
+static struct eos_pool_s instances[EOS_MAX_POOLS] = { 0 };
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static eos_pool_t AllocateDescriptor(void)
+{
+    // Variable con el resultado del descriptor asignado
+    eos_pool_t self = NULL;
+
+    for (int index = 0; index < EOS_MAX_POOLS; index++) {
+        if (instances[index].data == NULL) {
+            self = &(instances[index]);
+            break;
+        }
+    }
+    return self;
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+uint32_t PoolAvaiables(void)
+{
+    uint32_t result = 0;
+
+    for (int index = 0; index < EOS_MAX_POOLS; index++) {
+        if (instances[index].data == NULL) {
+            result++;
+        }
+    }
+    return result;
+}
+
+eos_pool_t PoolCreate(void* data, uint32_t block_size, uint32_t block_count)
+{
+    eos_pool_t self = NULL;
+
+    // Los bloques deben estar alineados a palabra para almacenar el puntero de la lista
+    if (data && block_count && (block_size >= sizeof(struct block_s)) && !(block_size & 0x03)
+        && !((uintptr_t)data & 0x03)) {
+        self = AllocateDescriptor();
+    }
+
+    if (self) {
+        self->data = data;
+        self->block_size = block_size;
+        self->block_count = block_count;
+        self->waiting->first = NULL;
+        self->waiting->last = NULL;
+
+        // Se enlazan los bloques en orden para que se asignen desde el inicio de la memoria
+        self->free = NULL;
+        for (uint32_t index = block_count; index > 0; index--) {
+            block_t block = (block_t)((uint8_t*)data + (index - 1) * block_size);
+            block->next = self->free;
+            self->free = block;
+        }
+    }
+    return self;
+}
+
+void* PoolAllocate(eos_pool_t self, uint32_t timeout)
+{
+    block_t block = self->free;
+
+    if (block) {
+        self->free = block->next;
+    } else if (!HandlerActive() && timeout) {
+        // No hay bloques libres, el bloque lo asigna la tarea que lo libere antes del vencimiento
+        TaskWait(self->waiting, timeout);
+    }
+    return block;
+}
+
+void PoolFree(eos_pool_t self, void* block)
+{
+    uint32_t offset = (uint8_t*)block - (uint8_t*)self->data;
+    eos_task_t task;
+
+    if ((offset < self->block_size * self->block_count) && (offset % self->block_size == 0)) {
+        task = self->waiting->first;
+        if (task) {
+            // El bloque liberado se entrega directamente a la primera tarea que lo esperaba
+            TaskWakeup(task, (uintptr_t)block);
+        } else {
+            ((block_t)block)->next = self->free;
+            self->free = block;
+        }
+    }
+}
+
+void PoolDestroy(eos_pool_t self)
+{
+    // Se libera la memoria ocupada por la instancia del grupo de bloques
+    memset(self, 0, sizeof(struct eos_pool_s));
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,380 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @file mutex.c
+ ** @brief Implementación de las funciones privadas para la gestion de mutex
+ **
+ ** Cuando una tarea espera un mutex, el dueño hereda su prioridad para que las tareas de
+ ** prioridad intermedia no puedan demorar la liberación. Si el dueño espera a su vez otro mutex
+ ** la herencia se propaga a lo largo de la cadena de dueños.
+ **
+ ** Los mutex con techo de prioridad elevan al dueño hasta el techo en el momento en que lo toma,
+ ** por lo que ninguna tarea que comparta el recurso lo puede desalojar durante la sección critica
+ ** y la tarea que lo espera solo se ejecuta despues de la liberación, con un unico cambio de
+ ** contexto. Ambos protocolos se combinan en el calculo de la prioridad efectiva del dueño.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   7 | 2026.10.16 | evolentini      | Degradacion del dueno de un mutex sin presupuesto       |
+ **|   6 | 2026.10.16 | evolentini      | Error por techo de prioridad inferior a la tarea        |
+ **|   5 | 2026.10.16 | evolentini      | Reduccion de prioridad de tareas que esperan un mutex   |
+ **|   4 | 2026.10.16 | evolentini      | Herencia de prioridad al vencer la espera de un mutex   |
+ **|   3 | 2026.10.16 | evolentini      | Cambio de prioridad de las tareas en ejecucion          |
+ **|   2 | 2026.10.16 | evolentini      | Mutex con techo de prioridad inmediato                  |
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "mutex.h"
+#include "tareas.h"
+#include "eos_api.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Definiciones y Macros =================================================================== */
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Estructura de datos con la información de un mutex
+struct eos_mutex_s {
+    //! Indica que el descriptor esta asignado a un mutex
+    bool used;
+    //! Puntero a la tarea que posee el mutex o NULL si esta libre
+    eos_task_t owner;
+    //! Cantidad de veces que el dueño tomó el mutex sin liberarlo
+    uint32_t count;
+    //! Prioridad a la que se eleva el dueño del mutex o cero si usa herencia de prioridades
+    uint8_t ceiling;
+    //! Lista de las tareas que esperan la liberación del mutex
+    struct task_list_s waiting[1];
+};
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/**
+ * @brief Busca y asigna un desciptor para un nuevo mutex
+ */
+static eos_mutex_t AllocateDescriptor(void);
+
+/**
+ * @brief Busca la tarea de mayor prioridad que espera un mutex
+ *
+ * @param mutex Puntero al descriptor del mutex
+ * @return      Puntero a la tarea de mayor prioridad o NULL si ninguna tarea espera el mutex
+ */
+static eos_task_t HighestWaiting(eos_mutex_t self);
+
+/**
+ * @brief Busca el mutex por el que espera una tarea
+ *
+ * @param task  Puntero al descriptor de la tarea
+ * @return      Puntero al mutex que espera la tarea o NULL si no esta bloqueada en un mutex
+ */
+static eos_mutex_t BlockingMutex(eos_task_t task);
+
+/**
+ * @brief Calcula la prioridad que hereda una tarea por los mutex que posee
+ *
+ * @param task      Puntero al descriptor de la tarea
+ * @param priority  Prioridad minima que se devuelve
+ * @return          Mayor valor entre la prioridad minima, los techos de los mutex que posee la
+ *                  tarea y las prioridades de las tareas que esperan esos mutex
+ */
+static uint8_t HeldPriority(eos_task_t task, uint8_t priority);
+
+/**
+ * @brief Determina si una tarea es dueña de al menos un mutex
+ *
+ * @param task  Puntero al descriptor de la tarea
+ * @return      true si la tarea posee algún mutex
+ */
+static bool OwnsMutex(eos_task_t task);
+
+/**
+ * @brief Calcula la prioridad que le corresponde a una tarea por los mutex que posee
+ *
+ * @param task  Puntero al descriptor de la tarea
+ * @return      Mayor valor entre la prioridad asignada a la tarea, los techos de los mutex que
+ *              posee y las prioridades de las tareas que esperan esos mutex
+ */
+static uint8_t InheritedPriority(eos_task_t task);
+
+/**
+ * @brief Recalcula la prioridad de los dueños de una cadena de mutex
+ *
+ * @remark La prioridad de cada dueño puede subir o bajar, por lo que se usa tanto cuando una tarea
+ * empieza a esperar un mutex como cuando deja de esperarlo sin recibirlo.
+ *
+ * @param mutex     Puntero al primer mutex de la cadena o NULL si la tarea no espera un mutex
+ */
+static void UpdatePriority(eos_mutex_t mutex);
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Variable local con el almacenamiento de las instancias de los mutex
+static struct eos_mutex_s instances[EOS_MAX_MUTEXES] = { 0 };
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static eos_mutex_t AllocateDescriptor(void)
+{
+    // Variable con el resultado del descriptor asignado
+    eos_mutex_t self = NULL;
+
+    for (int index = 0; index < EOS_MAX_MUTEXES; index++) {
+        if (!instances[index].used) {
+            self = &(instances[index]);
+            break;
+        }
+    }
+    return self;
+}
+
+static eos_task_t HighestWaiting(eos_mutex_t self)
+{
+    eos_task_t result = self->waiting->first;
+
+    // Ante prioridades iguales se respeta el orden de llegada
+    for (eos_task_t task = result; task; task = TaskNext(task)) {
+        if (TaskGetPriority(task) > TaskGetPriority(result)) {
+            result = task;
+        }
+    }
+    return result;
+}
+
+static eos_mutex_t BlockingMutex(eos_task_t task)
+{
+    task_list_t list = TaskGetList(task);
+    eos_mutex_t result = NULL;
+
+    for (int index = 0; index < EOS_MAX_MUTEXES; index++) {
+        if (list == instances[index].waiting) {
+            result = &(instances[index]);
+            break;
+        }
+    }
+    return result;
+}
+
+static uint8_t HeldPriority(eos_task_t task, uint8_t priority)
+{
+    uint8_t result = priority;
+    eos_task_t waiting;
+
+    for (int index = 0; index < EOS_MAX_MUTEXES; index++) {
+        if (instances[index].owner == task) {
+            if (instances[index].ceiling > result) {
+                result = instances[index].ceiling;
+            }
+            waiting = HighestWaiting(&instances[index]);
+            if (waiting && TaskGetPriority(waiting) > result) {
+                result = TaskGetPriority(waiting);
+            }
+        }
+    }
+    return result;
+}
+
+static bool OwnsMutex(eos_task_t task)
+{
+    for (int index = 0; index < EOS_MAX_MUTEXES; index++) {
+        if (instances[index].owner == task) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint8_t InheritedPriority(eos_task_t task)
+{
+    uint8_t priority = TaskGetBasePriority(task);
+
+#if EOS_TASK_BUDGET
+    // Un dueño degradado sigue sin su prioridad asignada hasta liberar todos sus mutex
+    if (TaskBudgetExhausted(task) && OwnsMutex(task)) {
+        priority = 0;
+    }
+#endif
+    return HeldPriority(task, priority);
+}
+
+static void UpdatePriority(eos_mutex_t mutex)
+{
+    uint8_t priority;
+
+    // El recorrido termina en el primer dueño cuya prioridad no cambia, porque de ella dependen
+    // las prioridades de los dueños siguientes
+    for (; mutex; mutex = BlockingMutex(mutex->owner)) {
+        priority = InheritedPriority(mutex->owner);
+        if (TaskGetPriority(mutex->owner) == priority) {
+            break;
+        }
+        TaskSetPriority(mutex->owner, priority);
+    }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+uint32_t MutexAvaiables(void)
+{
+    uint32_t result = 0;
+
+    for (int index = 0; index < EOS_MAX_MUTEXES; index++) {
+        if (!instances[index].used) {
+            result++;
+        }
+    }
+    return result;
+}
+
+eos_mutex_t MutexCreate(uint8_t ceiling)
+{
+    eos_mutex_t self = AllocateDescriptor();
+
+    if (self) {
+        self->used = true;
+        self->owner = NULL;
+        self->count = 0;
+        self->ceiling = ceiling;
+        self->waiting->first = NULL;
+        self->waiting->last = NULL;
+    }
+    return self;
+}
+
+bool MutexLock(eos_mutex_t self, uint32_t timeout)
+{
+    eos_task_t task = TaskGetDescriptor();
+    bool result = true;
+
+    // Con techo de prioridad ninguna tarea que use el mutex puede tener una prioridad asignada
+    // mayor al techo, la prioridad efectiva si lo puede superar por los mutex que ya posee
+    if (self->ceiling && TaskGetBasePriority(task) > self->ceiling) {
+        EosOnErrorCallback(EOS_ERRROR_MUTEX_CEILING);
+    }
+
+    if (self->owner == NULL) {
+        self->owner = task;
+        self->count = 1;
+        // Con techo de prioridad el dueño se eleva en forma inmediata
+        if (self->ceiling > TaskGetPriority(task)) {
+            TaskSetPriority(task, self->ceiling);
+        }
+    } else if (self->owner == task) {
+        self->count++;
+    } else {
+        result = false;
+        if (timeout) {
+            TaskWait(self->waiting, timeout);
+            UpdatePriority(self);
+        }
+    }
+    return result;
+}
+
+bool MutexUnlock(eos_mutex_t self)
+{
+    eos_task_t task = TaskGetDescriptor();
+    bool result = (self->owner == task);
+    eos_task_t next;
+
+    if (result) {
+        self->count--;
+        if (self->count == 0) {
+            // El mutex se entrega directamente a la tarea de mayor prioridad que lo esperaba
+            next = HighestWaiting(self);
+            self->owner = next;
+            if (next) {
+                self->count = 1;
+                TaskRemove(next);
+                TaskSetPriority(next, InheritedPriority(next));
+                TaskWakeup(next, true);
+            }
+            TaskSetPriority(task, InheritedPriority(task));
+        }
+    }
+    return result;
+}
+
+void MutexSetBasePriority(eos_task_t task, uint8_t priority)
+{
+    TaskSetBasePriority(task, priority);
+
+    // La prioridad efectiva conserva la herencia y los techos de los mutex que posee la tarea
+    TaskSetPriority(task, InheritedPriority(task));
+
+    // Si la tarea espera un mutex el cambio, tanto un aumento como una reducción, se propaga a
+    // lo largo de la cadena de dueños
+    UpdatePriority(BlockingMutex(task));
+}
+
+void MutexWaitTimeout(eos_task_t task)
+{
+    eos_mutex_t self = BlockingMutex(task);
+
+    // Sin la tarea en la lista de espera los dueños dejan de heredar su prioridad
+    if (self) {
+        TaskRemove(task);
+        UpdatePriority(self);
+    }
+}
+
+bool MutexDemote(eos_task_t task)
+{
+    bool result = OwnsMutex(task);
+
+    if (result) {
+        TaskSetPriority(task, HeldPriority(task, 0));
+    }
+    return result;
+}
+
+void MutexDestroy(eos_mutex_t self)
+{
+    // Se libera la memoria ocupada por la instancia del mutex
+    memset(self, 0, sizeof(struct eos_mutex_s));
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
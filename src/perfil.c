@@ -0,0 +1,112 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @file perfil.c
+ ** @brief Implementación de las funciones privadas para el perfilado estadistico por muestreo
+ **
+ ** Las muestras se almacenan en la variable global eos_profile, que se puede volcar desde el
+ ** depurador, por ejemplo con "dump binary value perfil.bin eos_profile" en gdb, y analizar junto
+ ** con el archivo ELF del programa con la herramienta tools/perfil/perfil.py.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "perfil.h"
+#include "tareas.h"
+#include <stddef.h>
+
+#if EOS_PROFILER
+
+/* === Definiciones y Macros =================================================================== */
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Cantidad de interrupciones del temporizador que faltan para tomar la siguiente muestra
+static uint32_t countdown = 0;
+
+/* === Definiciones de variables externas ====================================================== */
+
+//! Variable global con el registro de muestras, visible para volcarla desde el depurador
+struct profile_buffer_s eos_profile = {
+    .magic = PROFILE_MAGIC,
+    .version = PROFILE_VERSION,
+    .size = EOS_PROFILER_SIZE,
+};
+
+/* === Definiciones de funciones internas ====================================================== */
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void ProfilerStart(uint32_t tick_frequency)
+{
+    eos_profile.frequency = tick_frequency / EOS_PROFILER_PERIOD;
+    countdown = EOS_PROFILER_PERIOD;
+}
+
+void ProfilerSample(uint32_t pc, bool handler)
+{
+    profile_sample_t sample;
+
+    countdown--;
+    if (countdown == 0) {
+        countdown = EOS_PROFILER_PERIOD;
+
+        // El temporizador del sistema no puede ser interrumpido por otra muestra
+        sample = &eos_profile.samples[eos_profile.written & (EOS_PROFILER_SIZE - 1)];
+        sample->pc = pc;
+        sample->task = TaskIdentifier(TaskGetDescriptor());
+        sample->handler = handler;
+        sample->reserved = 0;
+        eos_profile.written++;
+    }
+}
+
+#endif
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
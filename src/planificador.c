@@ -38,6 +38,13 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|  12 | 2026.10.16 | evolentini      | Particiones de tiempo con un planificador cada una      |
+ **|  11 | 2026.10.16 | evolentini      | Planificador por vencimiento del plazo mas proximo      |
+ **|  10 | 2026.10.16 | evolentini      | Umbral de desalojo de las tareas                        |
+ **|   9 | 2026.10.16 | evolentini      | Mutex con herencia de prioridades                       |
+ **|   8 | 2026.10.16 | evolentini      | Reparto del procesador entre tareas de igual prioridad  |
+ **|   7 | 2026.10.16 | evolentini      | Listas de tareas con insercion en tiempo constante      |
+ **|   6 | 2026.10.16 | evolentini      | Seleccion de la cola de tareas con un mapa de bits      |
  **|   5 | 2021.08.10 | evolentini      | Uso de la lista enlazada de tareas para las colas       |
  **|   4 | 2021.08.09 | evolentini      | Se separan las funciones publicas y privadas del SO     |
  **|   3 | 2021.08.08 | evolentini      | Se agrega soporte para una tarea inactiva del sistema   |
@@ -54,66 +61,114 @@
 #include "tareas.h"
 #include <stddef.h>
 
+#if !EOS_SCHEDULER_EDF
+
 /* === Definiciones y Macros =================================================================== */
 
+//! Bit del mapa de tareas listas que corresponde a la cola de un indice determinado
+#define READY_BIT(index) (0x80000000U >> (index))
+
 /* === Declaraciones de tipos de datos internos ================================================ */
 
 struct scheduler_s {
-    eos_task_t queue[EOS_MAX_PRIORITY];
+    //! Mapa de bits con las colas que tienen tareas listas, el bit 31 corresponde a la cola 0
+    uint32_t ready;
+    //! Listas de tareas listas para ejecutar, la cola 0 corresponde a la mayor prioridad
+    struct task_list_s queue[EOS_MAX_PRIORITY];
     eos_task_t active_task;
     eos_task_t background_task;
 };
 
 /* === Declaraciones de funciones internas ===================================================== */
 
+/**
+ * @brief Función para obtener el indice de la cola que corresponde a una prioridad
+ *
+ * @param   priority    Prioridad de la tarea
+ * @return              Indice de la cola de tareas, la cola 0 es la de mayor prioridad
+ */
+static uint8_t QueueIndex(uint8_t priority);
+
 /* === Definiciones de variables internas ====================================================== */
 
 /* === Definiciones de variables externas ====================================================== */
 
-static struct scheduler_s instances[1] = { 0 };
+static struct scheduler_s instances[EOS_MAX_PARTITIONS] = { 0 };
 
 /* === Definiciones de funciones internas ====================================================== */
 
+static uint8_t QueueIndex(uint8_t priority)
+{
+    if (priority >= EOS_MAX_PRIORITY) {
+        priority = 0;
+    } else {
+        priority = EOS_MAX_PRIORITY - priority - 1;
+    }
+    return priority;
+}
+
 /* === Definiciones de funciones externas ====================================================== */
 
-scheduler_t SchedulerCreate(eos_task_t background_task)
+scheduler_t SchedulerCreate(eos_task_t background_task, uint8_t partition)
 {
-    // Solo se puede crear una instancia del planificador
-    instances->background_task = background_task;
-    return instances;
+    // Cada partición tiene su propia instancia del planificador
+    scheduler_t self = &instances[partition];
+
+    self->background_task = background_task;
+    return self;
 }
 
 void SchedulerEnqueue(scheduler_t self, eos_task_t task, uint8_t priority)
 {
-    if (priority >= EOS_MAX_PRIORITY) {
-        priority = 0;
-    } else {
-        priority = EOS_MAX_PRIORITY - priority - 1;
-    }
+    priority = QueueIndex(priority);
 
-    if (self->queue[priority] == NULL) {
-        self->queue[priority] = task;
-    } else {
-        TaskEnqueue(self->queue[priority], task);
+    TaskEnqueue(&self->queue[priority], task);
+    self->ready |= READY_BIT(priority);
+}
+
+bool SchedulerHasReady(scheduler_t self, uint8_t priority)
+{
+    return (self->ready & READY_BIT(QueueIndex(priority))) != 0;
+}
+
+void SchedulerRemove(scheduler_t self, eos_task_t task, uint8_t priority)
+{
+    priority = QueueIndex(priority);
+
+    TaskRemove(task);
+    if (self->queue[priority].first == NULL) {
+        self->ready &= ~READY_BIT(priority);
     }
 }
 
+bool SchedulerHasReadyAbove(scheduler_t self, uint8_t priority)
+{
+    // Las prioridades mayores corresponden a las colas con indice menor a la cola consultada
+    uint8_t index = QueueIndex(priority);
+
+    return (index > 0) && ((self->ready & ~(0xFFFFFFFFU >> index)) != 0);
+}
+
 eos_task_t Schedule(scheduler_t self)
 {
     uint8_t priority;
 
-    self->active_task = self->background_task;
-    for (priority = 0; priority < EOS_MAX_PRIORITY; priority++) {
-        if (self->queue[priority] != NULL) {
-            self->active_task = self->queue[priority];
-            self->queue[priority] = TaskDequeue(self->queue[priority]);
-            break;
+    if (self->ready) {
+        // La cantidad de ceros a la izquierda es el indice de la cola de mayor prioridad
+        priority = __builtin_clz(self->ready);
+        self->active_task = TaskDequeue(&self->queue[priority]);
+        if (self->queue[priority].first == NULL) {
+            self->ready &= ~READY_BIT(priority);
         }
+    } else {
+        self->active_task = self->background_task;
     }
 
     return self->active_task;
 }
 
+#endif
+
 /* === Ciere de documentacion ================================================================== */
 
 /** @} Final de la definición del modulo para doxygen */
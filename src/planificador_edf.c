@@ -0,0 +1,275 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file planificador_edf.c
+ ** @brief Implementación del planificador de tareas por vencimiento del plazo mas proximo
+ **
+ ** Esta implementación reemplaza al planificador por prioridades fijas cuando se habilita la
+ ** opción EOS_SCHEDULER_EDF. Las tareas listas se almacenan en un monticulo binario ordenado por
+ ** el vencimiento absoluto de su plazo, por lo que agregar, retirar y seleccionar una tarea tiene
+ ** un costo logaritmico con la cantidad de tareas listas. Cada tarea guarda su posición en el
+ ** monticulo para retirarla sin recorrerlo. Las prioridades de las tareas no se consideran en la
+ ** planificación.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   3 | 2026.10.16 | evolentini      | Retiro de tareas listas sin recorrer el monticulo       |
+ **|   2 | 2026.10.16 | evolentini      | Particiones de tiempo con un planificador cada una      |
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "planificador.h"
+#include "tareas.h"
+#include <stddef.h>
+
+#if EOS_SCHEDULER_EDF
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Indice del elemento padre de un elemento del monticulo
+#define PARENT(index) (((index) - 1) / 2)
+
+//! Indice del primer elemento hijo de un elemento del monticulo
+#define CHILD(index) (2 * (index) + 1)
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Estructura de un elemento del monticulo de tareas listas
+typedef struct ready_entry_s {
+    //! Puntero al descriptor de la tarea lista
+    eos_task_t task;
+    //! Tick en el que vence el plazo de la tarea
+    uint32_t deadline;
+    //! Orden de llegada de la tarea para desempatar los plazos iguales
+    uint32_t order;
+} * ready_entry_t;
+
+struct scheduler_s {
+    //! Cantidad de tareas listas almacenadas en el monticulo
+    uint32_t count;
+    //! Contador de tareas encoladas que define el orden de llegada
+    uint32_t order;
+    //! Monticulo de tareas listas, el elemento 0 es el de vencimiento mas proximo
+    struct ready_entry_s heap[EOS_MAX_TASK_COUNT];
+    //! Tarea seleccionada por la ultima llamada al planificador
+    eos_task_t active_task;
+    //! Tarea inactiva que se ejecuta cuando no hay tareas listas
+    eos_task_t background_task;
+};
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/**
+ * @brief Función para comparar el orden de dos elementos del monticulo
+ *
+ * @remark Los ticks se comparan por diferencia para tolerar el desborde del contador
+ *
+ * @param   first   Puntero al primer elemento
+ * @param   second  Puntero al segundo elemento
+ * @return          Verdadero si el primer elemento vence antes o llegó antes con el mismo plazo
+ */
+static bool Earlier(ready_entry_t first, ready_entry_t second);
+
+/**
+ * @brief Función para ubicar un elemento en una posición del monticulo
+ *
+ * @param   self    Puntero a la instancia del planificador
+ * @param   index   Indice de la posición en la que se ubica el elemento
+ * @param   entry   Elemento que se ubica, la tarea guarda la nueva posición
+ */
+static void Place(scheduler_t self, uint32_t index, struct ready_entry_s entry);
+
+/**
+ * @brief Función para intercambiar dos elementos del monticulo
+ *
+ * @param   self    Puntero a la instancia del planificador
+ * @param   first   Indice del primer elemento
+ * @param   second  Indice del segundo elemento
+ */
+static void Swap(scheduler_t self, uint32_t first, uint32_t second);
+
+/**
+ * @brief Función para restituir el orden del monticulo a partir de un elemento
+ *
+ * @param   self    Puntero a la instancia del planificador
+ * @param   index   Indice del elemento que puede estar fuera de orden
+ */
+static void Reorder(scheduler_t self, uint32_t index);
+
+/**
+ * @brief Función para retirar un elemento del monticulo
+ *
+ * @param   self    Puntero a la instancia del planificador
+ * @param   index   Indice del elemento que se retira
+ */
+static void Extract(scheduler_t self, uint32_t index);
+
+/* === Definiciones de variables internas ====================================================== */
+
+/* === Definiciones de variables externas ====================================================== */
+
+static struct scheduler_s instances[EOS_MAX_PARTITIONS] = { 0 };
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static bool Earlier(ready_entry_t first, ready_entry_t second)
+{
+    int32_t difference = (int32_t)(first->deadline - second->deadline);
+
+    if (difference == 0) {
+        difference = (int32_t)(first->order - second->order);
+    }
+    return difference < 0;
+}
+
+static void Place(scheduler_t self, uint32_t index, struct ready_entry_s entry)
+{
+    self->heap[index] = entry;
+    TaskSetReadyIndex(entry.task, index);
+}
+
+static void Swap(scheduler_t self, uint32_t first, uint32_t second)
+{
+    struct ready_entry_s entry = self->heap[first];
+
+    Place(self, first, self->heap[second]);
+    Place(self, second, entry);
+}
+
+static void Reorder(scheduler_t self, uint32_t index)
+{
+    uint32_t child;
+
+    // Si el elemento vence antes que su padre se lo sube hacia la raiz
+    while (index > 0 && Earlier(&self->heap[index], &self->heap[PARENT(index)])) {
+        Swap(self, index, PARENT(index));
+        index = PARENT(index);
+    }
+
+    // Si alguno de sus hijos vence antes se lo baja hacia las hojas
+    for (child = CHILD(index); child < self->count; child = CHILD(index)) {
+        if (child + 1 < self->count && Earlier(&self->heap[child + 1], &self->heap[child])) {
+            child++;
+        }
+        if (!Earlier(&self->heap[child], &self->heap[index])) {
+            break;
+        }
+        Swap(self, index, child);
+        index = child;
+    }
+}
+
+static void Extract(scheduler_t self, uint32_t index)
+{
+    // El ultimo elemento ocupa el lugar del retirado y se reubica en el monticulo
+    self->count--;
+    if (index < self->count) {
+        Place(self, index, self->heap[self->count]);
+        Reorder(self, index);
+    }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+scheduler_t SchedulerCreate(eos_task_t background_task, uint8_t partition)
+{
+    // Cada partición tiene su propia instancia del planificador
+    scheduler_t self = &instances[partition];
+
+    self->background_task = background_task;
+    return self;
+}
+
+void SchedulerEnqueue(scheduler_t self, eos_task_t task, uint8_t priority)
+{
+    struct ready_entry_s entry = {
+        .task = task,
+        .deadline = TaskGetDeadline(task),
+        .order = self->order++,
+    };
+
+    (void)priority;
+    Place(self, self->count, entry);
+    self->count++;
+    Reorder(self, self->count - 1);
+}
+
+bool SchedulerHasReady(scheduler_t self, uint8_t priority)
+{
+    // Sin prioridades cualquier tarea lista puede compartir el procesador
+    (void)priority;
+    return self->count > 0;
+}
+
+bool SchedulerHasReadyAbove(scheduler_t self, uint8_t priority)
+{
+    // Sin prioridades cualquier tarea lista puede desalojar a la tarea en ejecución
+    (void)priority;
+    return self->count > 0;
+}
+
+void SchedulerRemove(scheduler_t self, eos_task_t task, uint8_t priority)
+{
+    uint32_t index = TaskGetReadyIndex(task);
+
+    // La posición guardada solo es valida si la tarea todavia esta en el monticulo
+    (void)priority;
+    if (index < self->count && self->heap[index].task == task) {
+        Extract(self, index);
+    }
+}
+
+eos_task_t Schedule(scheduler_t self)
+{
+    if (self->count) {
+        self->active_task = self->heap[0].task;
+        Extract(self, 0);
+    } else {
+        self->active_task = self->background_task;
+    }
+
+    return self->active_task;
+}
+
+#endif
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -38,6 +38,10 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   6 | 2026.10.16 | evolentini      | Registro de eventos del nucleo en memoria               |
+ **|   5 | 2026.10.16 | evolentini      | Esperas en semaforos ordenadas por prioridad            |
+ **|   4 | 2026.10.16 | evolentini      | Tiempo maximo de espera en semaforos y colas            |
+ **|   3 | 2026.10.16 | evolentini      | Listas de tareas con insercion en tiempo constante      |
  **|   2 | 2021.08.15 | evolentini      | Compatibilidad con los handlers de interrupciones       |
  **|   1 | 2021.08.08 | evolentini      | Version inicial del archivo                             |
  **
@@ -50,7 +54,9 @@
 #include "semaforos.h"
 #include "tareas.h"
 #include "interrupciones.h"
+#include "traza.h"
 #include <stddef.h>
+#include <string.h>
 
 /* === Definiciones y Macros =================================================================== */
 
@@ -58,8 +64,13 @@
 struct eos_semaphore_s {
     //! Valor actual del semaforo contador, siempre es un entero positivo
     int32_t value;
-    //! Puntero a la primera tarea que espera la liberacion del semaforo
-    eos_task_t waiting;
+#if EOS_SEMAPHORE_PRIORITY_ORDER
+    //! Lista de las tareas que esperan la liberacion del semaforo ordenada por prioridad
+    struct task_queue_s waiting[1];
+#else
+    //! Lista de las tareas que esperan la liberacion del semaforo
+    struct task_list_s waiting[1];
+#endif
 };
 
 /* === Declaraciones de tipos de datos internos ================================================ */
@@ -102,7 +113,7 @@ eos_semaphore_t SemaphoreCreate(int32_t initial_value)
     eos_semaphore_t self = AllocateDescriptor();
 
     if (self) {
-        self->waiting = NULL;
+        memset(self->waiting, 0, sizeof(self->waiting));
         self->value = initial_value;
     }
     return self;
@@ -110,33 +121,37 @@ eos_semaphore_t SemaphoreCreate(int32_t initial_value)
 
 void SemaphoreGive(eos_semaphore_t self)
 {
-    if (self->waiting) {
-        eos_task_t task = self->waiting;
-        self->waiting = TaskDequeue(task);
-        TaskSetState(task, READY);
-        SchedulingRequired();
+#if EOS_SEMAPHORE_PRIORITY_ORDER
+    eos_task_t task = TaskQueueFirst(self->waiting);
+#else
+    eos_task_t task = self->waiting->first;
+#endif
+
+    TRACE_EVENT(TRACE_SEMAPHORE_GIVE, self - instances);
+    if (task) {
+        // La unidad se entrega directamente a la tarea que sigue en la lista de espera
+        TaskWakeup(task, true);
+        TRACE_TASK_EVENT(TRACE_SEMAPHORE_TAKE, task, self - instances);
     } else {
         self->value++;
     }
 }
 
-bool SemaphoreTake(eos_semaphore_t self)
+bool SemaphoreTake(eos_semaphore_t self, uint32_t timeout)
 {
     bool result = false;
 
     if (self->value > 0) {
         self->value--;
-    } else if (!HandlerActive()) {
-        eos_task_t task = TaskGetDescriptor();
-        if (self->waiting == NULL) {
-            self->waiting = task;
-        } else {
-            TaskEnqueue(self->waiting, task);
-        }
-        TaskSetState(task, WAITING);
-        SchedulingRequired();
-    } else {
-        result = false;
+        result = true;
+        TRACE_EVENT(TRACE_SEMAPHORE_TAKE, self - instances);
+    } else if (!HandlerActive() && timeout) {
+        TRACE_EVENT(TRACE_SEMAPHORE_BLOCK, self - instances);
+#if EOS_SEMAPHORE_PRIORITY_ORDER
+        TaskQueueWait(self->waiting, timeout);
+#else
+        TaskWait(self->waiting, timeout);
+#endif
     }
 
     return result;
@@ -38,6 +38,35 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|  45 | 2026.10.16 | evolentini      | Primer trabajo periodico liberado al crear la tarea     |
+ **|  44 | 2026.10.16 | evolentini      | Presupuesto agotado mientras se posee un mutex          |
+ **|  43 | 2026.10.16 | evolentini      | Posicion de la tarea en el monticulo del EDF            |
+ **|  42 | 2026.10.16 | evolentini      | Demora maxima distinta de la espera sin limite          |
+ **|  41 | 2026.10.16 | evolentini      | Exclusion de interrupciones en el tick y los servicios  |
+ **|  40 | 2026.10.16 | evolentini      | Herencia de prioridad al vencer la espera de un mutex   |
+ **|  39 | 2026.10.16 | evolentini      | Tamano de pila por tarea y pilas suministradas          |
+ **|  38 | 2026.10.16 | evolentini      | Uso maximo de pila y deteccion de desbordes             |
+ **|  37 | 2026.10.16 | evolentini      | Histogramas de latencias de activacion por interrupcion |
+ **|  36 | 2026.10.16 | evolentini      | Perfilado estadistico por muestreo en el SysTick        |
+ **|  35 | 2026.10.16 | evolentini      | Registro de eventos del nucleo en memoria               |
+ **|  34 | 2026.10.16 | evolentini      | Estadisticas de uso del procesador por tarea e IRQ      |
+ **|  33 | 2026.10.16 | evolentini      | Particiones de tiempo con un planificador cada una      |
+ **|  32 | 2026.10.16 | evolentini      | Presupuesto de ciclos de ejecucion de las tareas        |
+ **|  31 | 2026.10.16 | evolentini      | Tareas periodicas y esperas hasta un tick absoluto      |
+ **|  30 | 2026.10.16 | evolentini      | Planificador por vencimiento del plazo mas proximo      |
+ **|  29 | 2026.10.16 | evolentini      | Umbral de desalojo de las tareas                        |
+ **|  28 | 2026.10.16 | evolentini      | Cambio de prioridad de las tareas en ejecucion          |
+ **|  27 | 2026.10.16 | evolentini      | Esperas en semaforos ordenadas por prioridad            |
+ **|  26 | 2026.10.16 | evolentini      | Mutex con herencia de prioridades                       |
+ **|  25 | 2026.10.16 | evolentini      | Grupos de bloques de memoria de tamaño fijo             |
+ **|  24 | 2026.10.16 | evolentini      | Reserva y adquisicion de elementos sin copia en colas   |
+ **|  23 | 2026.10.16 | evolentini      | Flujos de datos con un productor y un consumidor        |
+ **|  22 | 2026.10.16 | evolentini      | Colas como objetos del nucleo con un unico servicio     |
+ **|  21 | 2026.10.16 | evolentini      | Tiempo maximo de espera en semaforos y colas            |
+ **|  20 | 2026.10.16 | evolentini      | Modo sin ticks cuando solo se ejecuta la tarea inactiva |
+ **|  19 | 2026.10.16 | evolentini      | Lista ordenada por vencimiento para las esperas         |
+ **|  18 | 2026.10.16 | evolentini      | Reparto del procesador entre tareas de igual prioridad  |
+ **|  17 | 2026.10.16 | evolentini      | Listas de tareas doblemente enlazadas                   |
  **|  16 | 2021.08.16 | evolentini      | Se mueven las notificaciones al usuario a la API        |
  **|  15 | 2021.08.16 | evolentini      | Se incluye una funcion para ceder el procesador         |
  **|  14 | 2021.08.15 | evolentini      | Compatibilidad con los handlers de interrupciones       |
@@ -64,12 +93,35 @@
 #include "tareas.h"
 #include "planificador.h"
 #include "semaforos.h"
+#include "colas.h"
+#include "flujos.h"
+#include "memoria.h"
+#include "mutex.h"
+#include "periodicas.h"
+#include "interrupciones.h"
+#include "traza.h"
+#include "perfil.h"
 #include "sapi.h"
 #include <stddef.h>
 #include <stdint.h>
 
 /* === Definiciones y Macros =================================================================== */
 
+//! Plazo relativo de las tareas que no declaran un plazo, posterior a cualquier plazo declarado
+#define NO_DEADLINE 0x7FFFFFFFU
+
+//! Frecuencia en Hz de las interrupciones del temporizador del sistema
+#define TICK_FREQUENCY 5000
+
+//! Bit del valor de retorno de una excepción que indica que el contexto esta en la pila de tarea
+#define EXC_RETURN_PROCESS_STACK 0x04U
+
+//! Valor con el que se pinta la pila de las tareas para detectar la porción que nunca se utilizó
+#define STACK_PATTERN 0xA5A5A5A5U
+
+//! Alineación en bytes que requiere el estandar de llamadas del procesador para las pilas
+#define STACK_ALIGNMENT 8
+
 /* === Declaraciones de tipos de datos internos ================================================ */
 
 /**
@@ -80,12 +132,82 @@ typedef struct eos_task_s {
     eos_task_state_t state;
     //! Copia del puntero de pila de la tarea
     void* stack_pointer;
-    //! Cantidad de ticks para terminar la espera
+    //! Cantidad de ticks para terminar la espera despues de la tarea anterior en la lista
     uint32_t wait_ticks;
-    //! Prioridad actual de la tarea
+    //! Puntero a la siguiente tarea en la lista de esperas temporizadas
+    eos_task_t next_timer;
+    //! Puntero a la tarea anterior en la lista de esperas temporizadas
+    eos_task_t previous_timer;
+    //! Puntero al registro donde se devuelve el resultado del servicio que bloqueó a la tarea
+    uint32_t* result;
+    //! Puntero al bloque de datos que la tarea intercambia con el objeto que espera
+    void* buffer;
+    //! Cantidad de ticks que la tarea puede usar el procesador antes de cederlo
+    uint32_t time_slice;
+    //! Cantidad de ticks que le restan a la tarea para ceder el procesador
+    uint32_t slice_ticks;
+    //! Prioridad efectiva de la tarea, puede ser mayor a la asignada por herencia
     uint8_t priority;
-    //! Puntero a la siguiente tarea en la cola
+    //! Prioridad asignada a la tarea al crearla
+    uint8_t base_priority;
+    //! Prioridad que debe superar otra tarea para desalojarla, sin efecto si no supera a priority
+    uint8_t threshold;
+    //! Partición a la que pertenece la tarea
+    uint8_t partition;
+    //! Cantidad de ticks desde que la tarea se libera hasta que vence su plazo
+    uint32_t relative_deadline;
+    //! Tick en el que vence el plazo de la tarea desde su ultima liberación
+    uint32_t deadline;
+#if EOS_SCHEDULER_EDF
+    //! Posición de la tarea en el monticulo de tareas listas del planificador
+    uint32_t ready_index;
+#endif
+    //! Puntero a la función que implementa cada trabajo de una tarea periodica
+    eos_entry_point_t job;
+    //! Puntero al bloque de datos que recibe cada trabajo de una tarea periodica
+    void* job_data;
+    //! Tiempos de los trabajos de una tarea periodica
+    struct periodic_s periodic[1];
+#if EOS_TASK_BUDGET
+    //! Cantidad de ciclos que puede ejecutar la tarea en cada periodo, cero sin limite
+    uint32_t budget;
+    //! Cantidad de ticks entre las reposiciones del presupuesto de ciclos
+    uint32_t budget_period;
+    //! Cantidad de ciclos ejecutados por la tarea en el periodo en curso
+    uint32_t budget_used;
+    //! Tick en el que se repone el presupuesto de ciclos de la tarea
+    uint32_t replenish;
+#endif
+#if EOS_STACK_CHECK
+    //! Dirección mas baja de la pila asignada a la tarea, que se utiliza como centinela
+    uint32_t* stack_base;
+    //! Cantidad de bytes de la pila asignada a la tarea
+    uint16_t stack_size;
+    //! Indica que ya se notificó el desborde de la pila de la tarea
+    bool stack_overflow;
+#endif
+#if EOS_LATENCY
+    //! Indica que una interrupción despertó a la tarea y se debe medir su latencia de activación
+    bool wakeup_pending;
+    //! Interrupción que despertó a la tarea
+    uint8_t wakeup_source;
+    //! Valor del contador de ciclos al entrar a la interrupción que despertó a la tarea
+    uint32_t wakeup_time;
+#endif
+#if EOS_TASK_STATS
+    //! Cantidad de ciclos ejecutados por la tarea desde el inicio del planificador
+    uint64_t cycles;
+    //! Cantidad de veces que el planificador asignó el procesador a la tarea
+    uint32_t switches;
+#endif
+    //! Puntero a la siguiente tarea en la lista
     eos_task_t next_task;
+    //! Puntero a la tarea anterior en la lista
+    eos_task_t previous_task;
+    //! Puntero a la lista en la que se encuentra la tarea
+    task_list_t list;
+    //! Puntero a la lista de espera ordenada por prioridad en la que espera la tarea o NULL
+    task_queue_t queue;
 } * eos_task_t;
 
 /**
@@ -96,15 +218,49 @@ typedef struct kernel_s {
     struct eos_task_s background[1];
     //! Vector que almacena los descriptores de tareas
     struct eos_task_s tasks[EOS_MAX_TASK_COUNT][1];
-    //! Vector que proporciona espacio para la pila de las tareas
-    uint8_t eos_task_stacks[EOS_MAX_TASK_COUNT + 1][EOS_TASK_STACK_SIZE];
+    //! Vector que proporciona espacio para la pila de la tarea inactiva
+    uint8_t background_stack[EOS_TASK_STACK_SIZE] __attribute__((aligned(STACK_ALIGNMENT)));
+    //! Vector que proporciona espacio para las pilas de las tareas que no suministran su pila
+    uint8_t stack_pool[EOS_STACK_POOL_SIZE] __attribute__((aligned(STACK_ALIGNMENT)));
     //! Puntero al descriptor de la tarea en ejecución
     eos_task_t active_task;
     //! Variable con el indice de la ultima tarea creada
-    uint8_t last_created;
-    //! Puntero a la instancia del planificador
+    uint16_t last_created;
+    //! Puntero a la primera tarea de la lista de esperas temporizadas ordenada por vencimiento
+    eos_task_t timers;
+    //! Cantidad de ticks transcurridos desde el inicio del planificador
+    uint32_t ticks;
+    //! Cantidad de ciclos del procesador que dura un tick
+    uint32_t tick_reload;
+    //! Indica que el temporizador del sistema esta programado para una espera sin ticks
+    bool tickless;
+    //! Ciclos del tick en curso que habian transcurrido al iniciar la espera sin ticks
+    uint32_t tickless_offset;
+    //! Puntero a la instancia del planificador de la partición en ejecución
     scheduler_t scheduler;
-    // Variable con la ultima dirección de pila asignada
+    //! Vector con las instancias de los planificadores de cada partición
+    scheduler_t schedulers[EOS_MAX_PARTITIONS];
+    //! Vector con las ventanas del marco principal o NULL si solo se ejecuta la partición cero
+    eos_window_t windows;
+    //! Cantidad de ventanas del marco principal
+    uint8_t window_count;
+    //! Indice de la ventana en curso del marco principal
+    uint8_t window;
+    //! Cantidad de ticks que le restan a la ventana en curso
+    uint32_t window_ticks;
+    //! Partición en ejecución durante la ventana en curso
+    uint8_t partition;
+#if EOS_TASK_BUDGET || EOS_TASK_STATS
+    //! Valor del contador de ciclos en la ultima actualización de los ciclos de la tarea activa
+    uint32_t cycles;
+#endif
+#if EOS_TASK_STATS
+    //! Cantidad de ciclos ejecutados por las tareas, excepto la inactiva, y por las interrupciones
+    uint64_t busy;
+    //! Acumulador de ciclos del handler de interrupción en curso o NULL si se ejecuta una tarea
+    uint64_t* handler;
+#endif
+    // Variable con la primera dirección libre del espacio para pilas
     void* asigned_stack;
 } * kernel_t;
 
@@ -153,6 +309,35 @@ void TaskError(void);
  */
 static eos_task_t AllocateDescriptor(void);
 
+/**
+ * @brief Agrega una tarea al final de la lista de su prioridad en una lista de espera ordenada
+ *
+ * @param queue Lista de espera ordenada por prioridad
+ * @param task  Puntero al descriptor de la tarea que se agrega
+ */
+static void TaskQueueEnqueue(task_queue_t queue, eos_task_t task);
+
+/**
+ * @brief Determina si la tarea en ejecución debe ceder el procesador al planificador
+ *
+ * @param task  Puntero al descriptor de la tarea en ejecución
+ * @return      Falso si la tarea tiene un umbral de desalojo y ninguna tarea lista lo supera
+ */
+static bool TaskPreemptable(eos_task_t task);
+
+/**
+ * @brief Obtiene el planificador de la partición a la que pertenece una tarea
+ *
+ * @param task  Puntero al descriptor de la tarea
+ * @return      Puntero a la instancia del planificador de la partición de la tarea
+ */
+static scheduler_t TaskScheduler(eos_task_t task);
+
+/**
+ * @brief Cambia la partición en ejecución al terminar la ventana en curso del marco principal
+ */
+static void PartitionTick(void);
+
 /**
  * @brief Función para preparar el contexto inicial de una tarea nueva
  *
@@ -174,13 +359,98 @@ __attribute__((naked())) void RetoreContext(void* stack_pointer);
  */
 void TickEvent(void);
 
+#if EOS_TICKLESS_IDLE
+/**
+ * @brief Función para suprimir los ticks mientras solo se ejecuta la tarea inactiva
+ *
+ * @remark Se programa el temporizador del sistema para interrumpir cuando vence la primera espera
+ * temporizada o cuando se alcanza la máxima cuenta del temporizador.
+ */
+static void TicklessEnter(void);
+#endif
+
+#if EOS_TASK_BUDGET || EOS_TASK_STATS
+/**
+ * @brief Función para cargar a la tarea activa los ciclos ejecutados desde la ultima carga
+ *
+ * @remark Los ciclos se miden con el contador DWT_CYCCNT y se cargan en cada cambio de contexto, en
+ * cada tick y al entrar y salir de los handlers de interrupciones. Los ciclos de un handler se
+ * cargan a su acumulador y no a la tarea interrumpida. Al vencer el periodo de reposición del
+ * presupuesto se descartan los ciclos ya consumidos.
+ */
+void TaskCyclesCharge(void);
+#endif
+
+#if EOS_STACK_CHECK
+/**
+ * @brief Función para verificar que una tarea no desbordó su pila
+ *
+ * @remark Se verifica que el puntero de pila guardado no este por debajo de la pila asignada y
+ * que la palabra mas baja de la pila conserve el valor pintado. El desborde se notifica una única
+ * vez por tarea con el error @ref EOS_ERRROR_STACK_OVERFLOW.
+ *
+ * @param   task    Puntero al descriptor de la tarea que deja el procesador
+ */
+static void TaskStackCheck(eos_task_t task);
+#endif
+
+#if EOS_LATENCY
+/**
+ * @brief Función para registrar la latencia de activación de una tarea despertada en una
+ * interrupción, que se llama cuando el planificador le asigna el procesador
+ *
+ * @param   task    Puntero al descriptor de la tarea que comienza a ejecutarse
+ */
+static void TaskLatencyRecord(eos_task_t task);
+#endif
+
+#if EOS_TASK_BUDGET
+/**
+ * @brief Función para suspender la tarea activa si agotó su presupuesto de ciclos
+ *
+ * @remark La tarea se bloquea con una espera temporizada que termina al reponerse el presupuesto.
+ * Si posee un mutex no se bloquea, se degrada a la prioridad que hereda por sus mutex y se suspende
+ * en el primer tick despues de liberarlos.
+ */
+static void TaskBudgetEnforce(void);
+#endif
+
+/**
+ * @brief Función para agregar una tarea en la lista de esperas temporizadas
+ *
+ * @remark La lista se mantiene ordenada por vencimiento y cada tarea almacena la diferencia de
+ * ticks con la tarea anterior, por lo que en cada tick solo se actualiza la primera tarea.
+ *
+ * @param   task    Puntero al descriptor de la tarea que espera
+ * @param   ticks   Cantidad de ticks que debe durar la espera
+ */
+static void TimerStart(eos_task_t task, uint32_t ticks);
+
+/**
+ * @brief Función para retirar una tarea de la lista de esperas temporizadas
+ *
+ * @remark Si la tarea no se encuentra en la lista la función no tiene efecto
+ *
+ * @param   task    Puntero al descriptor de la tarea que se retira
+ */
+static void TimerStop(eos_task_t task);
+
+/**
+ * @brief Función para reservar una pila en el espacio para pilas del sistema operativo
+ *
+ * @param   size    Cantidad de bytes de la pila, multiplo de STACK_ALIGNMENT
+ * @return          Dirección mas baja de la pila reservada o NULL si no hay espacio suficiente
+ */
+static void* StackAllocate(uint32_t size);
+
 /**
  * @brief Función para asignar la pila a una tarea
  *
  * @param   task    Puntero al descriptor de la tarea a la que se asigna la pila
+ * @param   stack   Dirección mas baja del bloque de memoria utilizado como pila
  * @param   size    Canitdad de bytes que se desean asignar como pila a la tarea
  */
-void TaskAsignStack(eos_task_t task, uint16_t size);
+void TaskAsignStack(eos_task_t task, void* stack, uint16_t size);
 
 /**
  * @brief  Función para implementar la tarea inactiva del sistema
@@ -189,6 +459,14 @@ void TaskAsignStack(eos_task_t task, uint16_t size);
  */
 void TaskBackground(void* data);
 
+/**
+ * @brief  Función que ejecuta los trabajos de una tarea periodica
+ *
+ * @param   data    Puntero con los parametros, siempre es NULL para esta tarea porque los datos
+ *                  de cada trabajo se almacenan en el descriptor de la tarea
+ */
+void TaskPeriodic(void* data);
+
 /* === Definiciones de variables internas ====================================================== */
 
 /**
@@ -200,6 +478,86 @@ static struct kernel_s kernel[1] = { 0 };
 
 /* === Definiciones de funciones internas ====================================================== */
 
+#if EOS_TASK_BUDGET || EOS_TASK_STATS
+void TaskCyclesCharge(void)
+{
+    eos_task_t task = kernel->active_task;
+    uint32_t primask;
+    uint32_t cycles;
+
+    // Una interrupción que se atiende durante la carga no puede mover la marca del contador
+    __asm__ volatile("mrs %0, primask" : "=r"(primask));
+    __asm__ volatile("cpsid i");
+
+    cycles = DWT->CYCCNT - kernel->cycles;
+    kernel->cycles += cycles;
+
+#if EOS_TASK_STATS
+    if (kernel->handler) {
+        // Los ciclos de un handler no se cargan a la tarea interrumpida
+        *kernel->handler += cycles;
+        kernel->busy += cycles;
+        task = NULL;
+    } else if (task) {
+        task->cycles += cycles;
+        if (task != kernel->background) {
+            kernel->busy += cycles;
+        }
+    }
+#endif
+
+#if EOS_TASK_BUDGET
+    if (task && task->budget) {
+        if ((int32_t)(kernel->ticks - task->replenish) >= 0) {
+            task->budget_used = 0;
+            task->replenish = kernel->ticks + task->budget_period;
+        }
+        task->budget_used += cycles;
+    }
+#endif
+
+    __asm__ volatile("msr primask, %0" : : "r"(primask));
+}
+#endif
+
+#if EOS_STACK_CHECK
+static void TaskStackCheck(eos_task_t task)
+{
+    if (!task->stack_overflow
+        && (*task->stack_base != STACK_PATTERN || task->stack_pointer < (void*)task->stack_base)) {
+        task->stack_overflow = true;
+        EosOnErrorCallback(EOS_ERRROR_STACK_OVERFLOW);
+    }
+}
+#endif
+
+#if EOS_LATENCY
+static void TaskLatencyRecord(eos_task_t task)
+{
+    if (task->wakeup_pending) {
+        task->wakeup_pending = false;
+        HandlerLatencyRecord(task->wakeup_source, DWT->CYCCNT - task->wakeup_time);
+    }
+}
+#endif
+
+#if EOS_TASK_BUDGET
+static void TaskBudgetEnforce(void)
+{
+    eos_task_t task = kernel->active_task;
+
+    TaskCyclesCharge();
+    if (task && task->state == RUNNING && TaskBudgetExhausted(task)) {
+        // Si posee un mutex la tarea sigue solo con la prioridad heredada hasta liberarlo
+        if (!MutexDemote(task)) {
+            // La tarea no esta en un servicio, por lo que no se le devuelve ningun resultado
+            task->result = NULL;
+            TaskWait(NULL, task->replenish - kernel->ticks);
+        }
+    }
+}
+#endif
+
 void TaskError(void)
 {
     EosEndTaskCallback(kernel->active_task);
@@ -218,6 +576,45 @@ static eos_task_t AllocateDescriptor(void)
     return task;
 }
 
+static void TaskQueueEnqueue(task_queue_t queue, eos_task_t task)
+{
+    uint8_t priority = task->priority;
+
+    if (priority >= EOS_MAX_PRIORITY) {
+        priority = EOS_MAX_PRIORITY - 1;
+    }
+    TaskEnqueue(&queue->lists[priority], task);
+    task->queue = queue;
+    queue->waiting |= (1U << priority);
+}
+
+static bool TaskPreemptable(eos_task_t task)
+{
+    return (task->partition != kernel->partition) || (task->threshold <= task->priority)
+        || SchedulerHasReadyAbove(kernel->scheduler, task->threshold);
+}
+
+static scheduler_t TaskScheduler(eos_task_t task)
+{
+    return kernel->schedulers[task->partition];
+}
+
+static void PartitionTick(void)
+{
+    kernel->window_ticks--;
+    if (kernel->window_ticks == 0) {
+        kernel->window = (kernel->window + 1) % kernel->window_count;
+        kernel->window_ticks = kernel->windows[kernel->window].ticks;
+
+        // La tarea de la partición saliente se desaloja aunque tenga un umbral de desalojo
+        if (kernel->partition != kernel->windows[kernel->window].partition) {
+            kernel->partition = kernel->windows[kernel->window].partition;
+            kernel->scheduler = kernel->schedulers[kernel->partition];
+            SchedulingRequired();
+        }
+    }
+}
+
 void PrepareContext(eos_task_t task, eos_entry_point_t entry_point, void* data)
 {
     task->stack_pointer -= sizeof(struct eos_task_context_s);
@@ -252,30 +649,146 @@ __attribute__((naked())) void RetoreContext(void* stack_pointer)
 
 void TickEvent(void)
 {
-    for (int index = 0; index < EOS_MAX_TASK_COUNT; index++) {
-        eos_task_t task = kernel->tasks[index];
-        if (task->state == WAITING) {
-            task->wait_ticks--;
-            if (task->wait_ticks == 0) {
-                TaskSetState(task, READY);
+    eos_task_t active = kernel->active_task;
+
+    kernel->ticks++;
+
+    // Al terminar la ventana en curso se cambia la partición en ejecución
+    if (kernel->windows) {
+        PartitionTick();
+    }
+
+    // Si la tarea agotó su tiempo se rota la cola solo si hay otra tarea de la misma prioridad
+    if (active && active->state == RUNNING && active->time_slice) {
+        active->slice_ticks--;
+        if (active->slice_ticks == 0) {
+            active->slice_ticks = active->time_slice;
+            if (SchedulerHasReady(kernel->scheduler, active->priority)) {
                 SchedulingRequired();
             }
         }
     }
+
+    // Solo se descuenta el tiempo de la primera espera porque las demas son relativas a esta
+    if (kernel->timers) {
+        kernel->timers->wait_ticks--;
+        while (kernel->timers && kernel->timers->wait_ticks == 0) {
+            // Al vencer la espera se retira la tarea de la lista del objeto que esperaba
+            eos_task_t task = kernel->timers;
+            TimerStop(task);
+            // Si esperaba un mutex los dueños dejan de heredar su prioridad
+            MutexWaitTimeout(task);
+            TaskRemove(task);
+            TaskSetState(task, READY);
+            SchedulingRequired();
+        }
+    }
+
+#if EOS_TASK_BUDGET
+    // Una tarea que agotó su presupuesto espera hasta la reposición
+    TaskBudgetEnforce();
+#endif
     EosSysTickCallback();
 }
 
-void TaskAsignStack(eos_task_t task, uint16_t size)
+#if EOS_TICKLESS_IDLE
+static void TicklessEnter(void)
+{
+    uint32_t reload = kernel->tick_reload;
+    uint32_t idle = SysTick_LOAD_RELOAD_Msk / reload;
+
+    if (kernel->timers && kernel->timers->wait_ticks < idle) {
+        idle = kernel->timers->wait_ticks;
+    }
+
+    // No se suprimen los ticks si la espera es corta o si ya hay un tick pendiente de atender
+    __asm__ volatile("cpsid i");
+    if ((idle > 1) && !(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) {
+        SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+        kernel->tickless_offset = reload - 1 - SysTick->VAL;
+        SysTick->LOAD = idle * reload - kernel->tickless_offset - 1;
+        SysTick->VAL = 0;
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+        kernel->tickless = true;
+    }
+}
+#endif
+
+static void TimerStart(eos_task_t task, uint32_t ticks)
+{
+    eos_task_t previous = NULL;
+    eos_task_t next = kernel->timers;
+
+    // Se busca la posición descontando los tiempos de las esperas que vencen antes
+    while (next && next->wait_ticks <= ticks) {
+        ticks -= next->wait_ticks;
+        previous = next;
+        next = next->next_timer;
+    }
+
+    task->wait_ticks = ticks;
+    task->previous_timer = previous;
+    task->next_timer = next;
+    if (next) {
+        next->wait_ticks -= ticks;
+        next->previous_timer = task;
+    }
+    if (previous) {
+        previous->next_timer = task;
+    } else {
+        kernel->timers = task;
+    }
+}
+
+static void TimerStop(eos_task_t task)
+{
+    if (task->previous_timer || kernel->timers == task) {
+        // El tiempo de la tarea retirada se transfiere a la siguiente espera de la lista
+        if (task->next_timer) {
+            task->next_timer->wait_ticks += task->wait_ticks;
+            task->next_timer->previous_timer = task->previous_timer;
+        }
+        if (task->previous_timer) {
+            task->previous_timer->next_timer = task->next_timer;
+        } else {
+            kernel->timers = task->next_timer;
+        }
+        task->next_timer = NULL;
+        task->previous_timer = NULL;
+    }
+}
+
+static void* StackAllocate(uint32_t size)
 {
+    void* result = NULL;
+    uint32_t available;
+
     // Se inicializa el puntero la primera vez que se asigna una pila
     if (kernel->asigned_stack == NULL) {
-        kernel->asigned_stack = kernel->eos_task_stacks;
+        kernel->asigned_stack = kernel->stack_pool;
     }
 
-    // Se asigna la cantidad de memoria solicitada a la pila de la tarea
-    if (task) {
+    available = kernel->stack_pool + EOS_STACK_POOL_SIZE - (uint8_t*)kernel->asigned_stack;
+    if (size <= available) {
+        result = kernel->asigned_stack;
         kernel->asigned_stack += size;
-        task->stack_pointer = kernel->asigned_stack;
+    }
+    return result;
+}
+
+void TaskAsignStack(eos_task_t task, void* stack, uint16_t size)
+{
+    // Se asigna el bloque de memoria como pila de la tarea, que crece desde su dirección mas alta
+    if (task) {
+#if EOS_STACK_CHECK
+        // Se pinta la pila para medir la porción utilizada y detectar desbordes
+        task->stack_base = stack;
+        task->stack_size = size;
+        for (uint16_t index = 0; index < size / sizeof(uint32_t); index++) {
+            task->stack_base[index] = STACK_PATTERN;
+        }
+#endif
+        task->stack_pointer = stack + size;
     }
 }
 
@@ -289,22 +802,95 @@ void TaskBackground(void* data)
     }
 }
 
+void TaskPeriodic(void* data)
+{
+    eos_task_t task = kernel->active_task;
+
+    /* El primer trabajo se liberó al crear la tarea, aunque comience a ejecutarse despues */
+    while (1) {
+        task->job(task->job_data);
+        PeriodicComplete(task->periodic, task->relative_deadline, kernel->ticks);
+        EosWaitUntil(&task->periodic->release, task->periodic->period);
+    }
+}
+
 /* === Definiciones de funciones externas ====================================================== */
 
 eos_task_t TaskCreate(eos_entry_point_t entry_point, void* data, uint8_t priority)
 {
+    // Las tareas sin una pila propia utilizan el tamaño de pila predeterminado
+    return TaskCreateStack(entry_point, data, priority, NULL, EOS_TASK_STACK_SIZE);
+}
 
+eos_task_t TaskCreateStack(
+    eos_entry_point_t entry_point, void* data, uint8_t priority, void* stack, uint16_t size)
+{
     // Variable con el descriptor signado a la nueva tarea
-    eos_task_t task = AllocateDescriptor();
+    eos_task_t task = NULL;
+
+    // El tope de la pila debe quedar alineado para respetar el estandar de llamadas
+    size &= ~(STACK_ALIGNMENT - 1);
+
+    // El descriptor se reserva primero para no consumir memoria de pilas si no hay descriptores
+    task = AllocateDescriptor();
+
+    // Sin un bloque de memoria suministrado la pila se reserva en el espacio del sistema operativo
+    if (task && (stack == NULL)) {
+        stack = StackAllocate(size);
+        if (stack == NULL) {
+            // Si no hay memoria para la pila se devuelve el descriptor recien reservado
+            (kernel->last_created)--;
+            task = NULL;
+        }
+    }
+
     if (task) {
-        TaskAsignStack(task, EOS_TASK_STACK_SIZE);
+        TaskAsignStack(task, stack, size);
         task->priority = priority;
+        task->base_priority = priority;
+        task->threshold = 0;
+        task->relative_deadline = NO_DEADLINE;
+        task->time_slice = EOS_TIME_SLICE_TICKS;
         PrepareContext(task, entry_point, data);
         TaskSetState(task, READY);
     }
     return task;
 }
 
+eos_task_t TaskCreatePeriodic(eos_entry_point_t entry_point, void* data, uint8_t priority,
+    uint32_t period, uint32_t deadline)
+{
+    eos_task_t task;
+
+    // La tarea no se puede ejecutar hasta completar sus datos aunque ya este lista
+    __asm__ volatile("cpsid i");
+    task = TaskCreate(TaskPeriodic, NULL, priority);
+    if (task) {
+        task->job = entry_point;
+        task->job_data = data;
+        // El primer trabajo se libera al crearla, antes de iniciar el planificador el tick es cero
+        PeriodicStart(task->periodic, period, kernel->ticks);
+        TaskSetDeadline(task, deadline ? deadline : period);
+    }
+    __asm__ volatile("cpsie i");
+    return task;
+}
+
+uint32_t TaskDeadlineMisses(eos_task_t task)
+{
+    return task->periodic->misses;
+}
+
+void TaskWaitUntil(uint32_t tick)
+{
+    uint32_t ticks = tick - kernel->ticks;
+
+    // Si la activación ya ocurrió la tarea continua sin esperar
+    if ((int32_t)ticks > 0) {
+        TaskWait(NULL, ticks);
+    }
+}
+
 void TaskSetState(eos_task_t task, eos_task_state_t state)
 {
     if (task->state != state) {
@@ -313,63 +899,453 @@ void TaskSetState(eos_task_t task, eos_task_state_t state)
                 task->state = state;
             }
         } else {
+#if EOS_SCHEDULER_EDF
+            // El plazo se cuenta desde que la tarea se libera, no cuando pierde el procesador
+            if (state == READY && task->state != RUNNING) {
+                task->deadline = kernel->ticks + task->relative_deadline;
+            }
+#endif
             task->state = state;
             if (task->state == READY && kernel->scheduler) {
-                SchedulerEnqueue(kernel->scheduler, task, task->priority);
+                SchedulerEnqueue(TaskScheduler(task), task, task->priority);
             }
         }
     }
 }
 
+void TaskSetTimeSlice(eos_task_t task, uint32_t ticks)
+{
+    task->time_slice = ticks;
+    task->slice_ticks = ticks;
+}
+
+uint8_t TaskGetPriority(eos_task_t task)
+{
+    return task->priority;
+}
+
+uint8_t TaskGetBasePriority(eos_task_t task)
+{
+    return task->base_priority;
+}
+
+#if EOS_STACK_CHECK
+uint16_t TaskStackHighWater(eos_task_t task)
+{
+    uint16_t unused = 0;
+    uint16_t words;
+
+    if (task == NULL) {
+        task = kernel->background;
+    }
+
+    // La pila crece hacia abajo, por lo que la porción sin utilizar es la que conserva el pintado
+    words = task->stack_size / sizeof(uint32_t);
+    while (unused < words && task->stack_base[unused] == STACK_PATTERN) {
+        unused++;
+    }
+    return task->stack_size - unused * sizeof(uint32_t);
+}
+#endif
+
+void TaskSetBasePriority(eos_task_t task, uint8_t priority)
+{
+    task->base_priority = priority;
+}
+
+void TaskSetDeadline(eos_task_t task, uint32_t ticks)
+{
+#if EOS_SCHEDULER_EDF
+    // El vencimiento del trabajo en curso se recalcula a partir de su liberación
+    uint32_t release = task->deadline - task->relative_deadline;
+
+    task->relative_deadline = ticks ? ticks : NO_DEADLINE;
+    task->deadline = release + task->relative_deadline;
+
+    // Una tarea lista se reubica en el planificador con su nuevo vencimiento
+    if (task->state == READY && kernel->scheduler) {
+        SchedulerRemove(TaskScheduler(task), task, task->priority);
+        SchedulerEnqueue(TaskScheduler(task), task, task->priority);
+        SchedulingRequired();
+    }
+#else
+    task->relative_deadline = ticks ? ticks : NO_DEADLINE;
+#endif
+}
+
+uint32_t TaskGetDeadline(eos_task_t task)
+{
+    return task->deadline;
+}
+
+#if EOS_SCHEDULER_EDF
+void TaskSetReadyIndex(eos_task_t task, uint32_t index)
+{
+    task->ready_index = index;
+}
+
+uint32_t TaskGetReadyIndex(eos_task_t task)
+{
+    return task->ready_index;
+}
+#endif
+
+#if EOS_TASK_BUDGET
+void TaskSetBudget(eos_task_t task, uint32_t cycles, uint32_t period)
+{
+    // El limite se deshabilita mientras se actualizan los demas campos
+    task->budget = 0;
+    task->budget_period = period;
+    task->budget_used = 0;
+    task->replenish = kernel->ticks + period;
+    task->budget = (period > 0) ? cycles : 0;
+}
+
+bool TaskBudgetExhausted(eos_task_t task)
+{
+    return task->budget && task->budget_used >= task->budget;
+}
+#endif
+
+#if EOS_TASK_STATS
+uint64_t* TaskStatsHandler(uint64_t* cycles)
+{
+    uint64_t* previous;
+    uint32_t primask;
+
+    __asm__ volatile("mrs %0, primask" : "=r"(primask));
+    __asm__ volatile("cpsid i");
+
+    // Los ciclos hasta el cambio se cargan al acumulador anterior
+    TaskCyclesCharge();
+    previous = kernel->handler;
+    kernel->handler = cycles;
+
+    __asm__ volatile("msr primask, %0" : : "r"(primask));
+    return previous;
+}
+
+void TaskStatsLoad(eos_stats_t stats)
+{
+    uint64_t elapsed = (uint64_t)kernel->ticks * kernel->tick_reload;
+
+    stats->load = 0;
+    if (elapsed) {
+        stats->load = (stats->cycles >= elapsed) ? 100 : (uint8_t)(stats->cycles * 100 / elapsed);
+    }
+}
+
+void TaskGetStats(eos_task_t task, eos_stats_t stats)
+{
+    uint64_t elapsed = (uint64_t)kernel->ticks * kernel->tick_reload;
+
+    if (task == NULL) {
+        task = kernel->background;
+    }
+
+    // Se actualizan los ciclos de la tarea en ejecución antes de informarlos
+    TaskCyclesCharge();
+    stats->switches = task->switches;
+    if (task == kernel->background) {
+        // El contador de ciclos se detiene mientras el procesador duerme, por lo que el tiempo
+        // inactivo se calcula como el tiempo transcurrido que no se ocupó en otras actividades
+        stats->cycles = (elapsed > kernel->busy) ? elapsed - kernel->busy : 0;
+    } else {
+        stats->cycles = task->cycles;
+    }
+    TaskStatsLoad(stats);
+}
+#endif
+
+bool TaskSetPartition(eos_task_t task, uint8_t partition)
+{
+    bool result = (kernel->scheduler == NULL);
+
+    if (result) {
+        task->partition = partition;
+    }
+    return result;
+}
+
+bool TaskPartitionSchedule(eos_window_t windows, uint8_t count)
+{
+    bool result = (kernel->scheduler == NULL);
+
+    if (result) {
+        kernel->windows = windows;
+        kernel->window_count = count;
+    }
+    return result;
+}
+
+void TaskSetThreshold(eos_task_t task, uint8_t threshold)
+{
+    task->threshold = threshold;
+    SchedulingRequired();
+}
+
+void TaskSetPriority(eos_task_t task, uint8_t priority)
+{
+    if (task->priority != priority) {
+        // Una tarea lista se mueve a la cola de su nueva prioridad
+        if (task->state == READY && kernel->scheduler) {
+            SchedulerRemove(TaskScheduler(task), task, task->priority);
+            task->priority = priority;
+            SchedulerEnqueue(TaskScheduler(task), task, task->priority);
+        } else if (task->queue) {
+            // Una tarea en una lista de espera ordenada se mueve a la lista de su nueva prioridad
+            task_queue_t queue = task->queue;
+            TaskRemove(task);
+            task->priority = priority;
+            TaskQueueEnqueue(queue, task);
+        } else {
+            task->priority = priority;
+        }
+        SchedulingRequired();
+    }
+}
+
+task_list_t TaskGetList(eos_task_t task)
+{
+    return task->list;
+}
+
+eos_task_t TaskNext(eos_task_t task)
+{
+    return task->next_task;
+}
+
+void TaskWait(task_list_t list, uint32_t timeout)
+{
+    eos_task_t task = kernel->active_task;
+
+    if (list) {
+        TaskEnqueue(list, task);
+    }
+    TaskSetState(task, WAITING);
+    if (timeout != EOS_WAIT_FOREVER) {
+        TimerStart(task, timeout);
+    }
+    SchedulingRequired();
+}
+
+void TaskQueueWait(task_queue_t queue, uint32_t timeout)
+{
+    TaskQueueEnqueue(queue, kernel->active_task);
+    TaskWait(NULL, timeout);
+}
+
+eos_task_t TaskQueueFirst(task_queue_t queue)
+{
+    eos_task_t result = NULL;
+
+    if (queue->waiting) {
+        // La cantidad de ceros a la izquierda indica la mayor prioridad con tareas en espera
+        result = queue->lists[31 - __builtin_clz(queue->waiting)].first;
+    }
+    return result;
+}
+
+void TaskWakeup(eos_task_t task, uint32_t result)
+{
+    TimerStop(task);
+    TaskRemove(task);
+    if (task->result) {
+        *(task->result) = result;
+    }
+#if EOS_LATENCY
+    // Si la despierta una interrupción se mide el tiempo hasta que la tarea se ejecuta
+    task->wakeup_pending = HandlerWakeupSource(&task->wakeup_source, &task->wakeup_time);
+#endif
+    TaskSetState(task, READY);
+    SchedulingRequired();
+}
+
+void TaskSetBuffer(eos_task_t task, void* buffer)
+{
+    task->buffer = buffer;
+}
+
+void* TaskGetBuffer(eos_task_t task)
+{
+    return task->buffer;
+}
+
+uint32_t TaskTickCount(void)
+{
+    return kernel->ticks;
+}
+
+void TicklessWakeup(void)
+{
+    __asm__ volatile("cpsid i");
+    if (kernel->tickless) {
+        uint32_t reload = kernel->tick_reload;
+        uint32_t control = SysTick->CTRL;
+        uint32_t load = SysTick->LOAD;
+        uint32_t cycles;
+        uint32_t ticks;
+
+        // Se detiene el temporizador y se calculan los ciclos transcurridos desde el ultimo tick
+        SysTick->CTRL = control & ~SysTick_CTRL_ENABLE_Msk;
+        cycles = kernel->tickless_offset + load - SysTick->VAL;
+        if (control & SysTick_CTRL_COUNTFLAG_Msk) {
+            cycles += load + 1;
+        }
+        SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+
+        // Se reprograma el temporizador para completar el tick en curso y luego ticks normales
+        ticks = cycles / reload;
+        cycles = cycles % reload;
+        if (reload - cycles < 2) {
+            ticks++;
+            cycles = 0;
+        }
+        SysTick->LOAD = reload - cycles - 1;
+        SysTick->VAL = 0;
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+        SysTick->LOAD = reload - 1;
+        kernel->tickless = false;
+
+        // Se procesan los ticks suprimidos para mantener la cuenta y las esperas de las tareas
+        while (ticks--) {
+            TickEvent();
+        }
+
+        // El planificador vuelve a suprimir los ticks si no hay tareas listas
+        SchedulingRequired();
+    }
+    __asm__ volatile("cpsie i");
+}
+
 eos_task_t TaskGetDescriptor(void)
 {
     // Devuelve el puntero a la tarea actual
     return kernel->active_task;
 }
 
-void TaskEnqueue(eos_task_t first_task, eos_task_t last_task)
+#if EOS_TRACE || EOS_PROFILER
+uint8_t TaskIdentifier(eos_task_t task)
+{
+    uint8_t result = 0;
+
+    // La tarea inactiva, y el inicio antes de asignar una tarea, se identifican con cero
+    if (task && task != kernel->background) {
+        result = (uint8_t)(task - kernel->tasks[0] + 1);
+    }
+    return result;
+}
+#endif
+
+void TaskEnqueue(task_list_t list, eos_task_t task)
 {
-    eos_task_t task = first_task;
-    while (task->next_task != NULL) {
-        task = task->next_task;
+    task->list = list;
+    task->next_task = NULL;
+    task->previous_task = list->last;
+
+    if (list->last) {
+        list->last->next_task = task;
+    } else {
+        list->first = task;
     }
-    task->next_task = last_task;
+    list->last = task;
 }
 
-eos_task_t TaskDequeue(eos_task_t first_task)
+eos_task_t TaskDequeue(task_list_t list)
 {
-    eos_task_t task = first_task->next_task;
-    first_task->next_task = NULL;
+    eos_task_t task = list->first;
+    if (task) {
+        TaskRemove(task);
+    }
     return task;
 }
 
+void TaskRemove(eos_task_t task)
+{
+    task_list_t list = task->list;
+
+    if (list) {
+        if (task->previous_task) {
+            task->previous_task->next_task = task->next_task;
+        } else {
+            list->first = task->next_task;
+        }
+        if (task->next_task) {
+            task->next_task->previous_task = task->previous_task;
+        } else {
+            list->last = task->previous_task;
+        }
+        task->next_task = NULL;
+        task->previous_task = NULL;
+        task->list = NULL;
+
+        // En una lista de espera ordenada se borra el bit de la prioridad que quedó vacia
+        if (task->queue) {
+            if (list->first == NULL) {
+                task->queue->waiting &= ~(1U << (list - task->queue->lists));
+            }
+            task->queue = NULL;
+        }
+    }
+}
+
 void StartScheduler(void)
 {
     __asm__ volatile("cpsid i");
 
     /* Activate SysTick */
     SystemCoreClockUpdate();
-    SysTick_Config(SystemCoreClock / 5000);
+    kernel->tick_reload = SystemCoreClock / TICK_FREQUENCY;
+    SysTick_Config(kernel->tick_reload);
 
     /* Update priority set by SysTick_Config */
     NVIC_SetPriority(SVCall_IRQn, NVIC_EncodePriority(7, 0, 0));
     NVIC_SetPriority(SysTick_IRQn, NVIC_EncodePriority(7, 5, 0));
     NVIC_SetPriority(PendSV_IRQn, NVIC_EncodePriority(7, 6, 0));
 
+#if EOS_TASK_BUDGET || EOS_TASK_STATS || EOS_TRACE || EOS_LATENCY
+    /* Habilitación del contador de ciclos para medir el tiempo de ejecución de las tareas */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+#if EOS_TASK_BUDGET || EOS_TASK_STATS
+    kernel->cycles = DWT->CYCCNT;
+#endif
+#if EOS_TRACE
+    TraceStart();
+#endif
+#if EOS_PROFILER
+    ProfilerStart(TICK_FREQUENCY);
+#endif
+
     /* Creación de la tarea inactiva del sistema */
-    TaskAsignStack(kernel->background, EOS_TASK_STACK_SIZE);
+    TaskAsignStack(kernel->background, kernel->background_stack, EOS_TASK_STACK_SIZE);
     PrepareContext(kernel->background, TaskBackground, NULL);
     TaskSetState(kernel->background, READY);
 
-    /* Creación del planificador y encolado de las tareas creadas */
-    kernel->scheduler = SchedulerCreate(kernel->background);
+    /* Creación de los planificadores de las particiones y encolado de las tareas creadas */
+    for (int index = 0; index < EOS_MAX_PARTITIONS; index++) {
+        kernel->schedulers[index] = SchedulerCreate(kernel->background, index);
+    }
     for (int index = 0; index < EOS_MAX_TASK_COUNT; index++) {
         eos_task_t task = kernel->tasks[index];
         if (task->state == READY) {
-            SchedulerEnqueue(kernel->scheduler, task, task->priority);
+#if EOS_SCHEDULER_EDF
+            // Los plazos de las tareas creadas antes del inicio se cuentan desde el inicio
+            task->deadline = kernel->ticks + task->relative_deadline;
+#endif
+            SchedulerEnqueue(TaskScheduler(task), task, task->priority);
         }
     }
 
+    /* La ejecución comienza con la partición de la primera ventana del marco principal */
+    if (kernel->windows) {
+        kernel->window = 0;
+        kernel->window_ticks = kernel->windows->ticks;
+        kernel->partition = kernel->windows->partition;
+    }
+    kernel->scheduler = kernel->schedulers[kernel->partition];
+
     SchedulingRequired();
     __asm__ volatile("cpsie i");
 
@@ -389,8 +1365,29 @@ void SchedulingRequired(void)
 
 void SysTick_Handler(void)
 {
+#if EOS_PROFILER
+    // Al entrar a la interrupción LR indica si el contexto interrumpido se guardó en la pila de
+    // una tarea o en la pila principal, cuya posición se desconoce despues del prologo
+    uint32_t exc_return = (uint32_t)__builtin_return_address(0);
+    struct eos_task_context_auto_s* contexto;
+
+    if (exc_return & EXC_RETURN_PROCESS_STACK) {
+        contexto = (struct eos_task_context_auto_s*)__get_PSP();
+        ProfilerSample(contexto->pc, false);
+    } else {
+        ProfilerSample(0, true);
+    }
+#endif
+
     // Se llama a la funcion del sistema operativo para gestionar los tiempos
-    TickEvent();
+    if (kernel->tickless) {
+        TicklessWakeup();
+    } else {
+        // Las interrupciones que despiertan tareas no pueden modificar las listas durante el tick
+        __asm__ volatile("cpsid i");
+        TickEvent();
+        __asm__ volatile("cpsie i");
+    }
 }
 
 void SVC_Handler(void)
@@ -403,10 +1400,23 @@ void SVC_Handler(void)
     uint32_t data = contexto->r1;
     uint32_t resultado = 0;
 
+    // Las interrupciones que despiertan tareas no pueden modificar las listas durante el servicio
+    __asm__ volatile("cpsid i");
+
+    // Si el servicio bloquea a la tarea el resultado definitivo se escribe al despertarla
+    kernel->active_task->result = &(contexto->r0);
+    TRACE_EVENT(TRACE_SERVICE, service);
+
     switch (service) {
     case EOS_SERVICE_DELAY:
-        kernel->active_task->state = WAITING;
-        kernel->active_task->wait_ticks = data;
+        // Una espera de cero ticks solo cede el procesador y la espera maxima se acorta un tick
+        // para que no se confunda con una espera sin limite de la que la tarea nunca despierta
+        if (data) {
+            TaskWait(NULL, data != EOS_WAIT_FOREVER ? data : EOS_WAIT_FOREVER - 1);
+        }
+        break;
+    case EOS_SERVICE_WAIT_UNTIL:
+        TaskWaitUntil(data);
         break;
     case EOS_SERVICE_YIELD:
         // No es necesario agregar ninguna acción adicional porque
@@ -416,14 +1426,70 @@ void SVC_Handler(void)
         SemaphoreGive((eos_semaphore_t)data);
         break;
     case EOS_SERVICE_TAKE:
-        resultado = SemaphoreTake((eos_semaphore_t)data);
+        resultado = SemaphoreTake((eos_semaphore_t)data, contexto->r2);
+        break;
+    case EOS_SERVICE_QUEUE_GIVE:
+        resultado = QueueGive((eos_queue_t)data, (void*)contexto->r2, contexto->r3);
         break;
+    case EOS_SERVICE_QUEUE_TAKE:
+        resultado = QueueTake((eos_queue_t)data, (void*)contexto->r2, contexto->r3);
+        break;
+    case EOS_SERVICE_QUEUE_RESERVE:
+        resultado = (uint32_t)QueueReserve((eos_queue_t)data, contexto->r2);
+        break;
+    case EOS_SERVICE_QUEUE_COMMIT:
+        QueueCommit((eos_queue_t)data, (void*)contexto->r2);
+        break;
+    case EOS_SERVICE_QUEUE_ACQUIRE:
+        resultado = (uint32_t)QueueAcquire((eos_queue_t)data, contexto->r2);
+        break;
+    case EOS_SERVICE_QUEUE_RELEASE:
+        QueueRelease((eos_queue_t)data, (void*)contexto->r2);
+        break;
+    case EOS_SERVICE_POOL_ALLOCATE:
+        resultado = (uint32_t)PoolAllocate((eos_pool_t)data, contexto->r2);
+        break;
+    case EOS_SERVICE_POOL_FREE:
+        PoolFree((eos_pool_t)data, (void*)contexto->r2);
+        break;
+    case EOS_SERVICE_MUTEX_LOCK:
+        resultado = MutexLock((eos_mutex_t)data, contexto->r2);
+        break;
+    case EOS_SERVICE_MUTEX_UNLOCK:
+        resultado = MutexUnlock((eos_mutex_t)data);
+        break;
+    case EOS_SERVICE_TASK_PRIORITY:
+        MutexSetBasePriority((eos_task_t)data, contexto->r2);
+        break;
+    case EOS_SERVICE_TASK_THRESHOLD:
+        TaskSetThreshold((eos_task_t)data, contexto->r2);
+        break;
+    case EOS_SERVICE_STREAM_WAIT:
+        resultado = StreamWait((eos_stream_t)data, contexto->r2);
+        break;
+    case EOS_SERVICE_STREAM_WAKEUP:
+        StreamWakeup((eos_stream_t)data);
+        break;
+#if EOS_TASK_STATS
+    case EOS_SERVICE_TASK_STATS:
+        TaskGetStats((eos_task_t)data, (eos_stats_t)contexto->r2);
+        break;
+    case EOS_SERVICE_HANDLER_STATS:
+        HandlerGetStats(data, (eos_stats_t)contexto->r2);
+        break;
+#endif
+#if EOS_LATENCY
+    case EOS_SERVICE_HANDLER_LATENCY:
+        HandlerGetLatency(data, (uint32_t*)contexto->r2, contexto->r3);
+        break;
+#endif
     default:
         break;
     }
     contexto->r0 = resultado;
 
     SchedulingRequired();
+    __asm__ volatile("cpsie i");
 }
 
 __attribute__((naked())) void PendSV_Handler(void)
@@ -438,14 +1504,42 @@ __attribute__((naked())) void PendSV_Handler(void)
         __asm__ volatile("stmdb r0!, {r4-r11,lr}");
         __asm__ volatile("str r0, %0" : "=m"(kernel->active_task->stack_pointer));
 
-        if (kernel->active_task->state == RUNNING) {
+#if EOS_TASK_BUDGET || EOS_TASK_STATS
+        /* Se cargan a la tarea los ciclos que ejecutó hasta el cambio de contexto */
+        TaskCyclesCharge();
+#endif
+
+#if EOS_STACK_CHECK
+        /* Con el contexto ya guardado se verifica que la tarea no haya desbordado su pila */
+        TaskStackCheck(kernel->active_task);
+#endif
+
+        /* Con un umbral de desalojo la tarea solo cede el procesador a las tareas que lo superan */
+        if (kernel->active_task->state == RUNNING && TaskPreemptable(kernel->active_task)) {
             TaskSetState(kernel->active_task, READY);
         }
     }
 
     /* Se determina seleciona la proxima tarea que utilizará el procesador */
-    kernel->active_task = Schedule(kernel->scheduler);
-    TaskSetState(kernel->active_task, RUNNING);
+    if ((kernel->active_task == NULL) || (kernel->active_task->state != RUNNING)) {
+        kernel->active_task = Schedule(kernel->scheduler);
+        kernel->active_task->slice_ticks = kernel->active_task->time_slice;
+        TaskSetState(kernel->active_task, RUNNING);
+#if EOS_TASK_STATS
+        kernel->active_task->switches++;
+#endif
+        TRACE_EVENT(TRACE_SWITCH, 0);
+#if EOS_LATENCY
+        TaskLatencyRecord(kernel->active_task);
+#endif
+    }
+
+#if EOS_TICKLESS_IDLE
+    /* Si solo puede ejecutarse la tarea inactiva se suprimen los ticks innecesarios */
+    if (kernel->active_task == kernel->background) {
+        TicklessEnter();
+    }
+#endif
 
     /*  Se devuelve el uso del procesador a la tarea designada */
     RetoreContext(kernel->active_task->stack_pointer);
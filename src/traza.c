@@ -0,0 +1,115 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @file traza.c
+ ** @brief Implementación de las funciones privadas para el registro de eventos del nucleo
+ **
+ ** Los eventos se almacenan en la variable global eos_trace, que se puede volcar desde el
+ ** depurador, por ejemplo con "dump binary value traza.bin eos_trace" en gdb, y convertir al
+ ** formato de trazas de Chrome con la herramienta tools/traza/traza2json.
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "traza.h"
+#include "tareas.h"
+#include "sapi.h"
+#include <stddef.h>
+
+#if EOS_TRACE
+
+/* === Definiciones y Macros =================================================================== */
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+/* === Definiciones de variables externas ====================================================== */
+
+//! Variable global con el registro de eventos, visible para volcarla desde el depurador
+struct trace_buffer_s eos_trace = {
+    .magic = TRACE_MAGIC,
+    .version = TRACE_VERSION,
+    .size = EOS_TRACE_SIZE,
+};
+
+/* === Definiciones de funciones internas ====================================================== */
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void TraceStart(void)
+{
+    eos_trace.frequency = SystemCoreClock;
+}
+
+void TraceRecord(uint8_t event, uint16_t data)
+{
+    TraceRecordTask(event, TaskGetDescriptor(), data);
+}
+
+void TraceRecordTask(uint8_t event, eos_task_t task, uint16_t data)
+{
+    trace_record_t record;
+    uint32_t primask;
+
+    // Un evento de una interrupción no puede ocupar el mismo lugar del registro
+    __asm__ volatile("mrs %0, primask" : "=r"(primask));
+    __asm__ volatile("cpsid i");
+
+    record = &eos_trace.records[eos_trace.written & (EOS_TRACE_SIZE - 1)];
+    record->time = DWT->CYCCNT;
+    record->event = event;
+    record->task = TaskIdentifier(task);
+    record->data = data;
+    eos_trace.written++;
+
+    __asm__ volatile("msr primask, %0" : : "r"(primask));
+}
+
+#endif
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -38,6 +38,10 @@
  **
  **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
  **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   5 | 2026.10.16 | evolentini      | Esperas de varias tareas con reservas y adquisiciones   |
+ **|   4 | 2026.10.16 | evolentini      | Reserva y adquisicion de elementos sin copia en colas   |
+ **|   3 | 2026.10.16 | evolentini      | Colas como objetos del nucleo con un unico servicio     |
+ **|   2 | 2026.10.16 | evolentini      | Tiempo maximo de espera en semaforos y colas            |
  **|   1 | 2021.08.14 | evolentini      | Version inicial del archivo                             |
  **
  ** @addtogroup eos
@@ -48,13 +52,17 @@
 
 #include "unity.h"
 #include "colas.h"
-#include "mock_eos_api.h"
+#include "mock_tareas.h"
+#include "mock_interrupciones.h"
 
 /* === Definiciones y Macros =================================================================== */
 
 //! Definicion con la cantidad de datos que se peuden encolar en el vector suministrado
 #define DATA_COUNT 4
 
+//! Definicion con la cantidad de tareas simuladas que se pueden bloquear juntas en una cola
+#define TASK_COUNT 3
+
 //! Definicion con el tamano de los datos que se encolan
 #define DATA_SIZE sizeof(struct test_queue_s)
 
@@ -64,7 +72,7 @@
         char message[32];                                                                          \
         sprintf(message, "Index %d", index);                                                       \
         struct test_queue_s data[1];                                                               \
-        QueueTake(cola, data);                                                                     \
+        QueueTake(cola, data, EOS_WAIT_FOREVER);                                                   \
         TEST_ASSERT_EQUAL_MEMORY_MESSAGE(&EJEMPLOS[index], data, DATA_SIZE, message);              \
     }
 
@@ -76,6 +84,18 @@ struct test_queue_s {
     char dummy_string[8];
 };
 
+//! Estructura con el estado de una tarea simulada que se bloquea en la cola junto con otras
+struct tarea_simulada_s {
+    //! Lista de espera de la cola en la que esta bloqueada la tarea o NULL si no esta bloqueada
+    task_list_t lista;
+    //! Bloque de datos registrado por la tarea antes de bloquearse
+    void* buffer;
+    //! Resultado con el que se desperto la tarea
+    uint32_t resultado;
+    //! Orden de llegada de la tarea a la lista de espera
+    uint32_t orden;
+};
+
 /* === Declaraciones de funciones internas ===================================================== */
 
 /* === Definiciones de variables internas ====================================================== */
@@ -86,6 +106,21 @@ static struct test_queue_s data_storage[DATA_COUNT] = { 0 };
 //! Variable con el descriptor de la cola usado para las pruebas
 eos_queue_t cola = NULL;
 
+//! Variable que simula el descriptor de la tarea bloqueada en la cola
+static int tarea_simulada[1];
+
+//! Descriptor de la tarea bloqueada en la cola durante las pruebas
+static eos_task_t const TAREA = (eos_task_t)tarea_simulada;
+
+//! Lista de espera de la cola en la que se bloqueó la tarea simulada
+static task_list_t lista_espera = NULL;
+
+//! Tareas simuladas que se bloquean juntas en la cola durante las pruebas
+static struct tarea_simulada_s tareas[TASK_COUNT];
+
+//! Contador para registrar el orden de llegada de las tareas a las listas de espera
+static uint32_t llegadas;
+
 //! Vector con datos de ejemplo para encolar en las pruebas
 static const struct test_queue_s EJEMPLOS[] = {
     { .dummy_number = 1, .dummy_string = "UNO" },
@@ -94,16 +129,91 @@ static const struct test_queue_s EJEMPLOS[] = {
     { .dummy_number = 4, .dummy_string = "CUATRO" },
     { .dummy_number = 5, .dummy_string = "CINCO" },
     { .dummy_number = 6, .dummy_string = "SEIS" },
+    { .dummy_number = 7, .dummy_string = "SIETE" },
 };
 
 /* === Definiciones de variables externas ====================================================== */
 
 /* === Definiciones de funciones internas ====================================================== */
 
+//! Implementación simulada del bloqueo que agrega la tarea en la lista de espera de la cola
+void esperar_en_lista(task_list_t list, uint32_t timeout)
+{
+    lista_espera = list;
+    list->first = TAREA;
+    list->last = TAREA;
+}
+
+//! Implementación simulada del desbloqueo que retira la tarea de la lista de espera de la cola
+void despertar_tarea(eos_task_t task, uint32_t result)
+{
+    lista_espera->first = NULL;
+    lista_espera->last = NULL;
+}
+
+//! Actualiza el primer elemento de una lista de espera con la tarea simulada que llegó antes
+void actualizar_lista(task_list_t list)
+{
+    struct tarea_simulada_s* primera = NULL;
+
+    for (int index = 0; index < TASK_COUNT; index++) {
+        if ((tareas[index].lista == list) && (!primera || tareas[index].orden < primera->orden)) {
+            primera = &tareas[index];
+        }
+    }
+    list->first = (eos_task_t)primera;
+}
+
+//! Implementación simulada del bloqueo de la tarea activa cuando varias tareas usan la cola
+void esperar_varias(task_list_t list, uint32_t timeout)
+{
+    struct tarea_simulada_s* tarea = (struct tarea_simulada_s*)TaskGetDescriptor_fake.return_val;
+
+    tarea->lista = list;
+    tarea->buffer = TaskSetBuffer_fake.arg1_val;
+    tarea->orden = llegadas++;
+    actualizar_lista(list);
+}
+
+//! Implementación simulada del desbloqueo cuando varias tareas usan la cola
+void despertar_varias(eos_task_t task, uint32_t result)
+{
+    struct tarea_simulada_s* tarea = (struct tarea_simulada_s*)task;
+    task_list_t list = tarea->lista;
+
+    tarea->lista = NULL;
+    tarea->resultado = result;
+    actualizar_lista(list);
+}
+
+//! Implementación simulada de la consulta del bloque de datos registrado por una tarea
+void* bloque_registrado(eos_task_t task)
+{
+    return ((struct tarea_simulada_s*)task)->buffer;
+}
+
+//! Configura los dobles de prueba para que varias tareas se bloqueen juntas en la cola
+void usar_varias_tareas(void)
+{
+    memset(tareas, 0, sizeof(tareas));
+    llegadas = 0;
+    TaskWait_fake.custom_fake = esperar_varias;
+    TaskWakeup_fake.custom_fake = despertar_varias;
+    TaskGetBuffer_fake.custom_fake = bloque_registrado;
+}
+
+//! Bloquea una de las tareas simuladas como si hubiera llamado a la funcion indicada
+#define BLOQUEAR_TAREA(indice, llamada)                                                            \
+    do {                                                                                           \
+        TaskGetDescriptor_fake.return_val = (eos_task_t)&tareas[indice];                           \
+        TaskSetBuffer_fake.arg1_val = NULL;                                                        \
+        llamada;                                                                                   \
+    } while (0)
+
 void encolar_ejemplos(eos_queue_t cola, int desde, int hasta)
 {
     for (int index = desde; index <= hasta; index++) {
-        QueueGive(cola, &EJEMPLOS[index]);
+        QueueGive(cola, &EJEMPLOS[index], EOS_WAIT_FOREVER);
     }
 }
 
@@ -112,6 +222,10 @@ void encolar_ejemplos(eos_queue_t cola, int desde, int hasta)
 void setUp(void)
 {
     FFF_RESET_HISTORY();
+    // Las funciones se llaman desde una tarea salvo que la prueba indique lo contrario
+    TaskWait_fake.custom_fake = esperar_en_lista;
+    TaskWakeup_fake.custom_fake = despertar_tarea;
+    TaskGetDescriptor_fake.return_val = TAREA;
     cola = QueueCreate(data_storage, DATA_COUNT, DATA_SIZE);
 }
 
@@ -133,32 +247,88 @@ void test_crear_una_instancia_y_destruirla(void)
 
 void test_agregar_un_dato(void)
 {
-    // Cuando se agrega un elemento de la cola
-    QueueGive(cola, &EJEMPLOS[0]);
-    // Entoces se toma unidades de dos semaforos
-    TEST_ASSERT_EQUAL(2, EosSemaphoreTake_fake.call_count);
-    // Y se devuelven unidades en dos semaforos
-    TEST_ASSERT_EQUAL(2, EosSemaphoreGive_fake.call_count);
+    // Cuando se agrega un elemento a la cola
+    TEST_ASSERT_TRUE(QueueGive(cola, &EJEMPLOS[0], EOS_WAIT_FOREVER));
+    // Entoces la tarea no se bloquea
+    TEST_ASSERT_EQUAL(0, TaskWait_fake.call_count);
+    // Y no se despierta ninguna otra tarea
+    TEST_ASSERT_EQUAL(0, TaskWakeup_fake.call_count);
 }
 
-void test_sacar_un_dato(void)
+void test_sacar_un_dato_con_la_cola_vacia_bloquea_la_tarea(void)
 {
-    // Cuando se retira un elemento de la cola
+    // Cuando se retira un elemento de la cola vacia
     struct test_queue_s recibido[1];
-    QueueTake(cola, recibido);
-    // Entoces se toma unidades de dos semaforos
-    TEST_ASSERT_EQUAL(2, EosSemaphoreTake_fake.call_count);
-    // Y se devuelven unidades en dos semaforos
-    TEST_ASSERT_EQUAL(2, EosSemaphoreGive_fake.call_count);
+    TEST_ASSERT_FALSE(QueueTake(cola, recibido, 10));
+    // Entonces la tarea se bloquea por la cantidad de ticks indicada
+    TEST_ASSERT_EQUAL(1, TaskWait_fake.call_count);
+    TEST_ASSERT_EQUAL(10, TaskWait_fake.arg1_val);
+    // Y se registra el bloque donde se debe copiar el dato al despertarla
+    TEST_ASSERT_EQUAL_PTR(recibido, TaskSetBuffer_fake.arg1_val);
+}
+
+void test_sacar_un_dato_con_la_cola_vacia_en_una_interrupcion(void)
+{
+    // Cuando se retira un elemento de la cola vacia en una interrupcion
+    struct test_queue_s recibido[1];
+    HandlerActive_fake.return_val = true;
+    // Entonces no se puede retirar ningun elemento
+    TEST_ASSERT_FALSE(QueueTake(cola, recibido, 10));
+    // Y no se bloquea ninguna tarea
+    TEST_ASSERT_EQUAL(0, TaskWait_fake.call_count);
+}
+
+void test_agregar_un_dato_con_la_cola_llena_bloquea_la_tarea(void)
+{
+    // Cuando la cola esta llena
+    encolar_ejemplos(cola, 0, 3);
+    // Entonces no se puede agregar el elemento en forma inmediata
+    TEST_ASSERT_FALSE(QueueGive(cola, &EJEMPLOS[4], 10));
+    // Y la tarea se bloquea por la cantidad de ticks indicada
+    TEST_ASSERT_EQUAL(1, TaskWait_fake.call_count);
+    TEST_ASSERT_EQUAL(10, TaskWait_fake.arg1_val);
+    // Y se registra el bloque que se debe copiar al liberar un lugar
+    TEST_ASSERT_EQUAL_PTR(&EJEMPLOS[4], TaskSetBuffer_fake.arg1_val);
+}
+
+void test_agregar_un_dato_con_una_tarea_esperando(void)
+{
+    // Cuando una tarea espera un dato en la cola vacia
+    struct test_queue_s recibido[1];
+    QueueTake(cola, recibido, EOS_WAIT_FOREVER);
+    TaskGetBuffer_fake.return_val = recibido;
+    // Y se agrega un elemento a la cola
+    TEST_ASSERT_TRUE(QueueGive(cola, &EJEMPLOS[0], EOS_WAIT_FOREVER));
+    // Entonces el dato se copia directamente en el bloque de la tarea que esperaba
+    TEST_ASSERT_EQUAL_MEMORY(&EJEMPLOS[0], recibido, DATA_SIZE);
+    // Y la tarea se despierta con un resultado exitoso
+    TEST_ASSERT_EQUAL(1, TaskWakeup_fake.call_count);
+    TEST_ASSERT_EQUAL_PTR(TAREA, TaskWakeup_fake.arg0_val);
+    TEST_ASSERT_TRUE(TaskWakeup_fake.arg1_val);
+}
+
+void test_sacar_un_dato_con_una_tarea_esperando(void)
+{
+    // Cuando una tarea espera un lugar libre en la cola llena
+    encolar_ejemplos(cola, 0, 3);
+    QueueGive(cola, &EJEMPLOS[4], EOS_WAIT_FOREVER);
+    TaskGetBuffer_fake.return_val = (void*)&EJEMPLOS[4];
+    // Y se retira un elemento de la cola
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 0, 0);
+    // Entonces la tarea se despierta con un resultado exitoso
+    TEST_ASSERT_EQUAL(1, TaskWakeup_fake.call_count);
+    TEST_ASSERT_TRUE(TaskWakeup_fake.arg1_val);
+    // Y su dato se agrega al final de la cola
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 1, 4);
 }
 
 void test_agregar_un_dato_y_sacarlo(void)
 {
     // Cuando se agrega un elemento a la cola
     struct test_queue_s recibido[1];
-    QueueGive(cola, &EJEMPLOS[0]);
+    QueueGive(cola, &EJEMPLOS[0], EOS_WAIT_FOREVER);
     // Y se retira un elemento de la cola
-    QueueTake(cola, recibido);
+    QueueTake(cola, recibido, EOS_WAIT_FOREVER);
     // Entonces ambos elementos son iguales
     TEST_ASSERT_EQUAL_MEMORY(&EJEMPLOS[0], recibido, DATA_SIZE);
 }
@@ -184,6 +354,197 @@ void test_agregar_mas_elementos_que_la_capacidad_pero_sin_llenarla(void)
     TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 4, 4);
 }
 
+void test_reservar_un_lugar_y_confirmarlo(void)
+{
+    // Cuando se reserva un lugar en la cola
+    struct test_queue_s recibido[1];
+    struct test_queue_s* elemento = QueueReserve(cola, EOS_WAIT_FOREVER);
+    // Entonces el lugar se encuentra dentro del bloque de datos de la cola
+    TEST_ASSERT_EQUAL_PTR(&data_storage[0], elemento);
+    // Y el dato no se puede retirar antes de confirmarlo
+    *elemento = EJEMPLOS[0];
+    TEST_ASSERT_FALSE(QueueTake(cola, recibido, 0));
+    // Y al confirmarlo se puede retirar el dato construido en la cola
+    QueueCommit(cola, elemento);
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 0, 0);
+}
+
+void test_reservar_dos_lugares_sin_confirmar(void)
+{
+    // Cuando hay un lugar reservado en la cola
+    QueueReserve(cola, EOS_WAIT_FOREVER);
+    // Entonces no se puede reservar otro lugar en forma inmediata
+    TEST_ASSERT_NULL(QueueReserve(cola, 0));
+    TEST_ASSERT_EQUAL(0, TaskWait_fake.call_count);
+}
+
+void test_agregar_datos_con_un_lugar_reservado(void)
+{
+    // Cuando se agrega un dato mientras hay un lugar reservado
+    struct test_queue_s* elemento = QueueReserve(cola, EOS_WAIT_FOREVER);
+    encolar_ejemplos(cola, 1, 2);
+    // Y despues se confirma el lugar reservado
+    *elemento = EJEMPLOS[0];
+    QueueCommit(cola, elemento);
+    // Entonces los datos se retiran en el orden en que se ocuparon los lugares
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 0, 2);
+}
+
+void test_reservar_un_lugar_con_la_cola_llena_bloquea_la_tarea(void)
+{
+    // Cuando la cola esta llena
+    encolar_ejemplos(cola, 0, 3);
+    // Entonces no se puede reservar un lugar en forma inmediata
+    TEST_ASSERT_NULL(QueueReserve(cola, 10));
+    // Y la tarea se bloquea por la cantidad de ticks indicada sin un bloque de datos
+    TEST_ASSERT_EQUAL(1, TaskWait_fake.call_count);
+    TEST_ASSERT_EQUAL(10, TaskWait_fake.arg1_val);
+    TEST_ASSERT_NULL(TaskSetBuffer_fake.arg1_val);
+}
+
+void test_adquirir_un_dato_y_liberarlo(void)
+{
+    // Cuando la cola esta llena y se adquiere un elemento
+    encolar_ejemplos(cola, 0, 3);
+    struct test_queue_s* elemento = QueueAcquire(cola, EOS_WAIT_FOREVER);
+    // Entonces el elemento es el primer dato en el bloque de datos de la cola
+    TEST_ASSERT_EQUAL_PTR(&data_storage[0], elemento);
+    TEST_ASSERT_EQUAL_MEMORY(&EJEMPLOS[0], elemento, DATA_SIZE);
+    // Y su lugar no se puede ocupar hasta liberarlo
+    TEST_ASSERT_FALSE(QueueGive(cola, &EJEMPLOS[4], 0));
+    QueueRelease(cola, elemento);
+    TEST_ASSERT_TRUE(QueueGive(cola, &EJEMPLOS[4], 0));
+    // Y los datos restantes se retiran en orden
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 1, 4);
+}
+
+void test_retirar_datos_con_un_elemento_adquirido(void)
+{
+    // Cuando la cola esta llena y se adquiere un elemento
+    encolar_ejemplos(cola, 0, 3);
+    struct test_queue_s* elemento = QueueAcquire(cola, EOS_WAIT_FOREVER);
+    // Y se retira el dato siguiente
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 1, 1);
+    // Entonces no se libera ningun lugar hasta liberar el elemento adquirido
+    TEST_ASSERT_FALSE(QueueGive(cola, &EJEMPLOS[4], 0));
+    QueueRelease(cola, elemento);
+    encolar_ejemplos(cola, 4, 5);
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 2, 5);
+}
+
+void test_agregar_un_dato_con_una_tarea_esperando_adquirirlo(void)
+{
+    // Cuando una tarea espera adquirir un dato en la cola vacia
+    TEST_ASSERT_NULL(QueueAcquire(cola, EOS_WAIT_FOREVER));
+    TaskGetBuffer_fake.return_val = NULL;
+    // Y se agrega un elemento a la cola
+    TEST_ASSERT_TRUE(QueueGive(cola, &EJEMPLOS[0], EOS_WAIT_FOREVER));
+    // Entonces la tarea se despierta con la dirección del elemento dentro de la cola
+    TEST_ASSERT_EQUAL(1, TaskWakeup_fake.call_count);
+    TEST_ASSERT_EQUAL_UINT32((uintptr_t)&data_storage[0], TaskWakeup_fake.arg1_val);
+    TEST_ASSERT_EQUAL_MEMORY(&EJEMPLOS[0], &data_storage[0], DATA_SIZE);
+}
+
+void test_dos_tareas_esperando_adquirir_un_dato(void)
+{
+    // Cuando dos tareas esperan adquirir un dato en la cola vacia
+    usar_varias_tareas();
+    BLOQUEAR_TAREA(0, QueueAcquire(cola, EOS_WAIT_FOREVER));
+    BLOQUEAR_TAREA(1, QueueAcquire(cola, EOS_WAIT_FOREVER));
+    // Y se agregan dos elementos a la cola
+    encolar_ejemplos(cola, 0, 1);
+    // Entonces solo la primera tarea se despierta con el primer elemento
+    TEST_ASSERT_NULL(tareas[0].lista);
+    TEST_ASSERT_EQUAL_UINT32((uintptr_t)&data_storage[0], tareas[0].resultado);
+    TEST_ASSERT_NOT_NULL(tareas[1].lista);
+
+    // Cuando la primera tarea libera el elemento adquirido
+    QueueRelease(cola, &data_storage[0]);
+    // Entonces la segunda tarea se despierta con el segundo elemento
+    TEST_ASSERT_NULL(tareas[1].lista);
+    TEST_ASSERT_EQUAL_UINT32((uintptr_t)&data_storage[1], tareas[1].resultado);
+    // Y su lugar no se ocupa aunque se agreguen datos hasta llenar la cola
+    encolar_ejemplos(cola, 2, 5);
+    TEST_ASSERT_EQUAL_MEMORY(&EJEMPLOS[1], &data_storage[1], DATA_SIZE);
+    QueueRelease(cola, &data_storage[1]);
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 2, 5);
+}
+
+void test_confirmar_una_reserva_con_otra_tarea_esperando_reservar(void)
+{
+    // Cuando dos tareas esperan reservar un lugar y otra espera agregar un dato en la cola llena
+    usar_varias_tareas();
+    encolar_ejemplos(cola, 0, 3);
+    BLOQUEAR_TAREA(0, QueueReserve(cola, EOS_WAIT_FOREVER));
+    BLOQUEAR_TAREA(1, QueueReserve(cola, EOS_WAIT_FOREVER));
+    BLOQUEAR_TAREA(2, QueueGive(cola, &EJEMPLOS[6], EOS_WAIT_FOREVER));
+    // Y se retiran dos elementos
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 0, 1);
+    // Entonces solo la primera tarea recibe un lugar reservado y las demas siguen esperando
+    TEST_ASSERT_NULL(tareas[0].lista);
+    TEST_ASSERT_EQUAL_UINT32((uintptr_t)&data_storage[0], tareas[0].resultado);
+    TEST_ASSERT_NOT_NULL(tareas[1].lista);
+    TEST_ASSERT_NOT_NULL(tareas[2].lista);
+
+    // Cuando la primera tarea confirma su reserva
+    data_storage[0] = EJEMPLOS[4];
+    QueueCommit(cola, &data_storage[0]);
+    // Entonces la segunda tarea recibe el lugar liberado mientras habia una reserva
+    TEST_ASSERT_NULL(tareas[1].lista);
+    TEST_ASSERT_EQUAL_UINT32((uintptr_t)&data_storage[1], tareas[1].resultado);
+    // Y la tarea que esperaba agregar un dato sigue esperando porque la cola esta llena
+    TEST_ASSERT_NOT_NULL(tareas[2].lista);
+
+    // Cuando se retira otro elemento
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 2, 2);
+    // Entonces el dato de la tarea que esperaba se agrega detras del lugar reservado
+    TEST_ASSERT_NULL(tareas[2].lista);
+    TEST_ASSERT_TRUE(tareas[2].resultado);
+    data_storage[1] = EJEMPLOS[5];
+    QueueCommit(cola, &data_storage[1]);
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 3, 6);
+}
+
+void test_dos_tareas_reservan_un_lugar_al_mismo_tiempo(void)
+{
+    // Cuando una tarea reserva un lugar en la cola vacia
+    usar_varias_tareas();
+    TaskGetDescriptor_fake.return_val = (eos_task_t)&tareas[0];
+    TEST_ASSERT_EQUAL_PTR(&data_storage[0], QueueReserve(cola, EOS_WAIT_FOREVER));
+    // Entonces otra tarea que reserva un lugar se bloquea aunque haya lugares libres
+    BLOQUEAR_TAREA(1, TEST_ASSERT_NULL(QueueReserve(cola, EOS_WAIT_FOREVER)));
+    TEST_ASSERT_NOT_NULL(tareas[1].lista);
+
+    // Cuando la primera tarea confirma su reserva
+    data_storage[0] = EJEMPLOS[0];
+    QueueCommit(cola, &data_storage[0]);
+    // Entonces la segunda tarea se despierta con el lugar siguiente
+    TEST_ASSERT_NULL(tareas[1].lista);
+    TEST_ASSERT_EQUAL_UINT32((uintptr_t)&data_storage[1], tareas[1].resultado);
+    data_storage[1] = EJEMPLOS[1];
+    QueueCommit(cola, &data_storage[1]);
+    TEST_ASSERT_DEQUEUE_EQUAL_EXAMPLES(cola, 0, 1);
+}
+
+void test_dos_tareas_adquieren_un_dato_al_mismo_tiempo(void)
+{
+    // Cuando una tarea adquiere un dato de la cola con dos datos
+    usar_varias_tareas();
+    encolar_ejemplos(cola, 0, 1);
+    TaskGetDescriptor_fake.return_val = (eos_task_t)&tareas[0];
+    TEST_ASSERT_EQUAL_PTR(&data_storage[0], QueueAcquire(cola, EOS_WAIT_FOREVER));
+    // Entonces otra tarea que adquiere un dato se bloquea aunque haya datos en la cola
+    BLOQUEAR_TAREA(1, TEST_ASSERT_NULL(QueueAcquire(cola, EOS_WAIT_FOREVER)));
+    TEST_ASSERT_NOT_NULL(tareas[1].lista);
+
+    // Cuando la primera tarea libera el elemento adquirido
+    QueueRelease(cola, &data_storage[0]);
+    // Entonces la segunda tarea se despierta con el dato siguiente
+    TEST_ASSERT_NULL(tareas[1].lista);
+    TEST_ASSERT_EQUAL_UINT32((uintptr_t)&data_storage[1], tareas[1].resultado);
+    TEST_ASSERT_EQUAL_MEMORY(&EJEMPLOS[1], &data_storage[1], DATA_SIZE);
+}
+
 /* === Ciere de documentacion ================================================================== */
 
 /** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,239 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file test_flujos.c
+ ** @brief Pruebas unitarias de las funciones para la gestion de flujos de datos
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "unity.h"
+#include "flujos.h"
+#include "mock_tareas.h"
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Definicion con la cantidad de datos que se peuden almacenar en el vector suministrado
+#define DATA_COUNT 4
+
+//! Definicion con el tamano de los datos que se almacenan
+#define DATA_SIZE sizeof(struct test_stream_s)
+
+//! Macro auxiliar para leer datos del flujo y compararlos con los ejemplos
+#define TEST_ASSERT_READ_EQUAL_EXAMPLES(flujo, desde, hasta)                                       \
+    for (int index = desde; index <= hasta; index++) {                                             \
+        char message[32];                                                                          \
+        sprintf(message, "Index %d", index);                                                       \
+        struct test_stream_s data[1];                                                              \
+        TEST_ASSERT_TRUE_MESSAGE(StreamRead(flujo, data), message);                                \
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(&EJEMPLOS[index], data, DATA_SIZE, message);              \
+    }
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Estructura con un ejemplo para probar flujos de datos
+struct test_stream_s {
+    uint32_t dummy_number;
+    char dummy_string[8];
+};
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Vector para el almacenamiento de los datos del flujo
+static struct test_stream_s data_storage[DATA_COUNT] = { 0 };
+
+//! Variable con el descriptor del flujo usado para las pruebas
+eos_stream_t flujo = NULL;
+
+//! Variable que simula el descriptor de la tarea consumidora
+static int tarea_simulada[1];
+
+//! Descriptor de la tarea consumidora durante las pruebas
+static eos_task_t const TAREA = (eos_task_t)tarea_simulada;
+
+//! Vector con datos de ejemplo para almacenar en las pruebas
+static const struct test_stream_s EJEMPLOS[] = {
+    { .dummy_number = 1, .dummy_string = "UNO" },
+    { .dummy_number = 2, .dummy_string = "DOS" },
+    { .dummy_number = 3, .dummy_string = "TRES" },
+    { .dummy_number = 4, .dummy_string = "CUATRO" },
+    { .dummy_number = 5, .dummy_string = "CINCO" },
+    { .dummy_number = 6, .dummy_string = "SEIS" },
+};
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+//! Implementación simulada del bloqueo que agrega la tarea en la lista de espera del flujo
+void esperar_en_lista(task_list_t list, uint32_t timeout)
+{
+    list->first = TAREA;
+    list->last = TAREA;
+}
+
+void escribir_ejemplos(eos_stream_t flujo, int desde, int hasta)
+{
+    for (int index = desde; index <= hasta; index++) {
+        StreamWrite(flujo, &EJEMPLOS[index]);
+    }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void setUp(void)
+{
+    FFF_RESET_HISTORY();
+    TaskWait_fake.custom_fake = esperar_en_lista;
+    flujo = StreamCreate(data_storage, DATA_COUNT, DATA_SIZE);
+}
+
+void tearDown(void)
+{
+    // Liberación del flujo al terminar la prueba
+    StreamDestroy(flujo);
+}
+
+void test_crear_una_instancia_y_destruirla(void)
+{
+    int avaiables = StreamAvaiables();
+    eos_stream_t flujo = StreamCreate(data_storage, DATA_COUNT, DATA_SIZE);
+    TEST_ASSERT_EQUAL(avaiables - 1, StreamAvaiables());
+    TEST_ASSERT_NOT_NULL(flujo);
+    StreamDestroy(flujo);
+    TEST_ASSERT_EQUAL(avaiables, StreamAvaiables());
+}
+
+void test_crear_una_instancia_con_parametros_no_validos(void)
+{
+    // Cuando la capacidad no es una potencia de dos no se crea el flujo
+    TEST_ASSERT_NULL(StreamCreate(data_storage, 3, DATA_SIZE));
+    // Cuando el tamaño de los elementos no es multiplo de una palabra no se crea el flujo
+    TEST_ASSERT_NULL(StreamCreate(data_storage, DATA_COUNT, 6));
+    // Cuando el bloque de datos no esta alineado a palabra no se crea el flujo
+    TEST_ASSERT_NULL(StreamCreate((char*)data_storage + 1, DATA_COUNT, DATA_SIZE));
+}
+
+void test_leer_un_flujo_vacio(void)
+{
+    // Cuando se lee un flujo vacio no se obtiene ningun dato
+    struct test_stream_s recibido[1];
+    TEST_ASSERT_FALSE(StreamRead(flujo, recibido));
+}
+
+void test_escribir_un_dato_y_leerlo(void)
+{
+    // Cuando se escribe un dato en el flujo
+    TEST_ASSERT_TRUE(StreamWrite(flujo, &EJEMPLOS[0]));
+    // Entonces al leer el flujo se obtiene el mismo dato
+    TEST_ASSERT_READ_EQUAL_EXAMPLES(flujo, 0, 0);
+    // Y el flujo queda vacio
+    TEST_ASSERT_FALSE(StreamRead(flujo, &(struct test_stream_s) { 0 }));
+}
+
+void test_escribir_con_el_flujo_lleno(void)
+{
+    // Cuando se llena el flujo
+    escribir_ejemplos(flujo, 0, 3);
+    // Entonces el siguiente dato se descarta
+    TEST_ASSERT_FALSE(StreamWrite(flujo, &EJEMPLOS[4]));
+    // Y se leen los datos escritos antes de llenarlo
+    TEST_ASSERT_READ_EQUAL_EXAMPLES(flujo, 0, 3);
+}
+
+void test_escribir_mas_elementos_que_la_capacidad_pero_sin_llenarlo(void)
+{
+    // Cuando se escriben y leen los cuatro primeros ejemplos
+    escribir_ejemplos(flujo, 0, 3);
+    TEST_ASSERT_READ_EQUAL_EXAMPLES(flujo, 0, 3);
+    // Y se escriben dos ejemplos mas
+    escribir_ejemplos(flujo, 4, 5);
+    // Entonces al leer el flujo se obtienen los dos ultimos ejemplos
+    TEST_ASSERT_READ_EQUAL_EXAMPLES(flujo, 4, 5);
+}
+
+void test_esperar_con_el_flujo_vacio_bloquea_la_tarea(void)
+{
+    // Cuando el consumidor espera con el flujo vacio
+    TEST_ASSERT_FALSE(StreamWait(flujo, 10));
+    // Entonces la tarea se bloquea por la cantidad de ticks indicada
+    TEST_ASSERT_EQUAL(1, TaskWait_fake.call_count);
+    TEST_ASSERT_EQUAL(10, TaskWait_fake.arg1_val);
+    // Y el productor debe despertarla
+    TEST_ASSERT_TRUE(StreamWaiting(flujo));
+}
+
+void test_esperar_con_datos_en_el_flujo(void)
+{
+    // Cuando el consumidor espera con datos en el flujo
+    StreamWrite(flujo, &EJEMPLOS[0]);
+    TEST_ASSERT_TRUE(StreamWait(flujo, 10));
+    // Entonces la tarea no se bloquea
+    TEST_ASSERT_EQUAL(0, TaskWait_fake.call_count);
+    TEST_ASSERT_FALSE(StreamWaiting(flujo));
+}
+
+void test_despertar_al_consumidor(void)
+{
+    // Cuando el consumidor espera con el flujo vacio
+    StreamWait(flujo, EOS_WAIT_FOREVER);
+    // Y se lo despierta despues de escribir un dato
+    StreamWrite(flujo, &EJEMPLOS[0]);
+    StreamWakeup(flujo);
+    // Entonces la tarea se despierta con un resultado exitoso
+    TEST_ASSERT_EQUAL(1, TaskWakeup_fake.call_count);
+    TEST_ASSERT_EQUAL_PTR(TAREA, TaskWakeup_fake.arg0_val);
+    TEST_ASSERT_TRUE(TaskWakeup_fake.arg1_val);
+}
+
+void test_despertar_sin_consumidor_esperando(void)
+{
+    // Cuando no hay ninguna tarea esperando en el flujo no se despierta ninguna tarea
+    StreamWakeup(flujo);
+    TEST_ASSERT_EQUAL(0, TaskWakeup_fake.call_count);
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
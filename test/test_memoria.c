@@ -0,0 +1,208 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file test_memoria.c
+ ** @brief Pruebas unitarias de las funciones para la gestion de bloques de memoria
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "unity.h"
+#include "memoria.h"
+#include "mock_tareas.h"
+#include "mock_interrupciones.h"
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Definicion con la cantidad de bloques del grupo usado en las pruebas
+#define BLOCK_COUNT 4
+
+//! Definicion con el tamano de los bloques del grupo usado en las pruebas
+#define BLOCK_SIZE 16
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Vector con la memoria que se divide en bloques
+static uint32_t storage[BLOCK_COUNT * BLOCK_SIZE / sizeof(uint32_t)] = { 0 };
+
+//! Variable con el descriptor del grupo de bloques usado para las pruebas
+eos_pool_t grupo = NULL;
+
+//! Variable que simula el descriptor de la tarea bloqueada en el grupo
+static int tarea_simulada[1];
+
+//! Descriptor de la tarea bloqueada en el grupo durante las pruebas
+static eos_task_t const TAREA = (eos_task_t)tarea_simulada;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+//! Implementación simulada del bloqueo que agrega la tarea en la lista de espera del grupo
+void esperar_en_lista(task_list_t list, uint32_t timeout)
+{
+    list->first = TAREA;
+    list->last = TAREA;
+}
+
+//! Devuelve la dirección del bloque indicado dentro de la memoria del grupo
+void* bloque(int index)
+{
+    return (uint8_t*)storage + index * BLOCK_SIZE;
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void setUp(void)
+{
+    FFF_RESET_HISTORY();
+    TaskWait_fake.custom_fake = esperar_en_lista;
+    grupo = PoolCreate(storage, BLOCK_SIZE, BLOCK_COUNT);
+}
+
+void tearDown(void)
+{
+    // Liberación del grupo al terminar la prueba
+    PoolDestroy(grupo);
+}
+
+void test_crear_una_instancia_y_destruirla(void)
+{
+    int avaiables = PoolAvaiables();
+    eos_pool_t grupo = PoolCreate(storage, BLOCK_SIZE, BLOCK_COUNT);
+    TEST_ASSERT_EQUAL(avaiables - 1, PoolAvaiables());
+    TEST_ASSERT_NOT_NULL(grupo);
+    PoolDestroy(grupo);
+    TEST_ASSERT_EQUAL(avaiables, PoolAvaiables());
+}
+
+void test_crear_una_instancia_con_parametros_no_validos(void)
+{
+    // Cuando el tamaño de los bloques no es multiplo de una palabra no se crea el grupo
+    TEST_ASSERT_NULL(PoolCreate(storage, 6, BLOCK_COUNT));
+    // Cuando los bloques no pueden almacenar un puntero no se crea el grupo
+    TEST_ASSERT_NULL(PoolCreate(storage, 0, BLOCK_COUNT));
+    // Cuando la memoria no esta alineada a palabra no se crea el grupo
+    TEST_ASSERT_NULL(PoolCreate((uint8_t*)storage + 1, BLOCK_SIZE, BLOCK_COUNT));
+}
+
+void test_asignar_todos_los_bloques(void)
+{
+    // Cuando se asignan todos los bloques entonces se obtienen en orden desde el inicio
+    for (int index = 0; index < BLOCK_COUNT; index++) {
+        TEST_ASSERT_EQUAL_PTR(bloque(index), PoolAllocate(grupo, 0));
+    }
+    // Y no quedan bloques disponibles
+    TEST_ASSERT_NULL(PoolAllocate(grupo, 0));
+    TEST_ASSERT_EQUAL(0, TaskWait_fake.call_count);
+}
+
+void test_liberar_un_bloque_y_volver_a_asignarlo(void)
+{
+    // Cuando se asignan dos bloques y se libera el primero
+    void* primero = PoolAllocate(grupo, 0);
+    PoolAllocate(grupo, 0);
+    PoolFree(grupo, primero);
+    // Entonces el proximo bloque asignado es el liberado
+    TEST_ASSERT_EQUAL_PTR(primero, PoolAllocate(grupo, 0));
+}
+
+void test_liberar_una_direccion_que_no_es_un_bloque(void)
+{
+    // Cuando se asignan todos los bloques
+    for (int index = 0; index < BLOCK_COUNT; index++) {
+        PoolAllocate(grupo, 0);
+    }
+    // Y se liberan direcciones que no corresponden a bloques del grupo
+    PoolFree(grupo, (uint8_t*)bloque(1) + 4);
+    PoolFree(grupo, bloque(BLOCK_COUNT));
+    // Entonces no se agregan bloques libres
+    TEST_ASSERT_NULL(PoolAllocate(grupo, 0));
+}
+
+void test_asignar_sin_bloques_libres_bloquea_la_tarea(void)
+{
+    // Cuando no hay bloques libres
+    for (int index = 0; index < BLOCK_COUNT; index++) {
+        PoolAllocate(grupo, 0);
+    }
+    // Entonces no se puede asignar un bloque en forma inmediata
+    TEST_ASSERT_NULL(PoolAllocate(grupo, 10));
+    // Y la tarea se bloquea por la cantidad de ticks indicada
+    TEST_ASSERT_EQUAL(1, TaskWait_fake.call_count);
+    TEST_ASSERT_EQUAL(10, TaskWait_fake.arg1_val);
+}
+
+void test_asignar_sin_bloques_libres_en_una_interrupcion(void)
+{
+    // Cuando no hay bloques libres
+    for (int index = 0; index < BLOCK_COUNT; index++) {
+        PoolAllocate(grupo, 0);
+    }
+    // Entonces en una interrupción no se asigna un bloque y no se bloquea ninguna tarea
+    HandlerActive_fake.return_val = true;
+    TEST_ASSERT_NULL(PoolAllocate(grupo, 10));
+    TEST_ASSERT_EQUAL(0, TaskWait_fake.call_count);
+}
+
+void test_liberar_un_bloque_con_una_tarea_esperando(void)
+{
+    // Cuando una tarea espera un bloque libre
+    for (int index = 0; index < BLOCK_COUNT; index++) {
+        PoolAllocate(grupo, 0);
+    }
+    PoolAllocate(grupo, EOS_WAIT_FOREVER);
+    // Y se libera un bloque
+    PoolFree(grupo, bloque(2));
+    // Entonces la tarea se despierta con la dirección del bloque liberado
+    TEST_ASSERT_EQUAL(1, TaskWakeup_fake.call_count);
+    TEST_ASSERT_EQUAL_PTR(TAREA, TaskWakeup_fake.arg0_val);
+    TEST_ASSERT_EQUAL_UINT32((uintptr_t)bloque(2), TaskWakeup_fake.arg1_val);
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,534 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file test_mutex.c
+ ** @brief Pruebas unitarias de las funciones para la gestion de mutex
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   7 | 2026.10.16 | evolentini      | Degradacion del dueno de un mutex sin presupuesto       |
+ **|   6 | 2026.10.16 | evolentini      | Error por techo de prioridad inferior a la tarea        |
+ **|   5 | 2026.10.16 | evolentini      | Reduccion de prioridad de tareas que esperan un mutex   |
+ **|   4 | 2026.10.16 | evolentini      | Herencia de prioridad al vencer la espera de un mutex   |
+ **|   3 | 2026.10.16 | evolentini      | Cambio de prioridad de las tareas en ejecucion          |
+ **|   2 | 2026.10.16 | evolentini      | Mutex con techo de prioridad inmediato                  |
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "unity.h"
+#include "mutex.h"
+#include "mock_tareas.h"
+#include "mock_eos_api.h"
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Macro para obtener el descriptor de una de las tareas simuladas
+#define TAREA(indice) ((eos_task_t)&tareas[indice])
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Estructura con el estado de una tarea simulada en las pruebas
+typedef struct tarea_simulada_s {
+    //! Prioridad efectiva de la tarea
+    uint8_t prioridad;
+    //! Prioridad asignada a la tarea
+    uint8_t base;
+    //! Lista en la que espera la tarea
+    task_list_t lista;
+    //! Tarea siguiente en la lista de espera
+    struct tarea_simulada_s* siguiente;
+} * tarea_simulada_t;
+
+//! Indices de las tareas simuladas ordenadas por prioridad
+enum { BAJA, MEDIA, ALTA, TAREAS };
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Vector con el estado de las tareas simuladas
+static struct tarea_simulada_s tareas[TAREAS];
+
+//! Variable con el descriptor del mutex usado para las pruebas
+eos_mutex_t mutex = NULL;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+//! Implementación simulada de la prioridad efectiva de una tarea
+uint8_t obtener_prioridad(eos_task_t task)
+{
+    return ((tarea_simulada_t)task)->prioridad;
+}
+
+//! Implementación simulada de la prioridad asignada a una tarea
+uint8_t obtener_prioridad_base(eos_task_t task)
+{
+    return ((tarea_simulada_t)task)->base;
+}
+
+//! Implementación simulada del cambio de prioridad efectiva de una tarea
+void cambiar_prioridad(eos_task_t task, uint8_t priority)
+{
+    ((tarea_simulada_t)task)->prioridad = priority;
+}
+
+//! Implementación simulada del cambio de prioridad asignada a una tarea
+void cambiar_prioridad_base(eos_task_t task, uint8_t priority)
+{
+    ((tarea_simulada_t)task)->base = priority;
+}
+
+//! Implementación simulada de la lista en la que espera una tarea
+task_list_t obtener_lista(eos_task_t task)
+{
+    return ((tarea_simulada_t)task)->lista;
+}
+
+//! Implementación simulada de la tarea siguiente en una lista
+eos_task_t siguiente_tarea(eos_task_t task)
+{
+    return (eos_task_t)((tarea_simulada_t)task)->siguiente;
+}
+
+//! Implementación simulada del bloqueo que agrega la tarea en ejecución al final de la lista
+void esperar_en_lista(task_list_t list, uint32_t timeout)
+{
+    tarea_simulada_t tarea = (tarea_simulada_t)TaskGetDescriptor();
+
+    tarea->lista = list;
+    tarea->siguiente = NULL;
+    if (list->last) {
+        ((tarea_simulada_t)list->last)->siguiente = tarea;
+    } else {
+        list->first = (eos_task_t)tarea;
+    }
+    list->last = (eos_task_t)tarea;
+}
+
+//! Implementación simulada del retiro de una tarea de la lista en la que espera
+void retirar_de_lista(eos_task_t task)
+{
+    tarea_simulada_t tarea = (tarea_simulada_t)task;
+    task_list_t list = tarea->lista;
+    eos_task_t* anterior;
+
+    if (list) {
+        for (anterior = &list->first; *anterior != task;) {
+            anterior = (eos_task_t*)&((tarea_simulada_t)*anterior)->siguiente;
+        }
+        *anterior = (eos_task_t)tarea->siguiente;
+        if (list->last == task) {
+            list->last = NULL;
+            for (eos_task_t actual = list->first; actual; actual = siguiente_tarea(actual)) {
+                list->last = actual;
+            }
+        }
+        tarea->lista = NULL;
+        tarea->siguiente = NULL;
+    }
+}
+
+//! Implementación simulada del desbloqueo de una tarea
+void despertar_tarea(eos_task_t task, uint32_t result)
+{
+    retirar_de_lista(task);
+}
+
+//! Función auxiliar para tomar un mutex desde una de las tareas simuladas
+bool tomar(eos_mutex_t mutex, int tarea)
+{
+    TaskGetDescriptor_fake.return_val = TAREA(tarea);
+    return MutexLock(mutex, EOS_WAIT_FOREVER);
+}
+
+//! Función auxiliar para liberar un mutex desde una de las tareas simuladas
+bool liberar(eos_mutex_t mutex, int tarea)
+{
+    TaskGetDescriptor_fake.return_val = TAREA(tarea);
+    return MutexUnlock(mutex);
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void setUp(void)
+{
+    FFF_RESET_HISTORY();
+    for (int indice = 0; indice < TAREAS; indice++) {
+        tareas[indice] = (struct tarea_simulada_s) { .prioridad = indice, .base = indice };
+    }
+    TaskGetPriority_fake.custom_fake = obtener_prioridad;
+    TaskGetBasePriority_fake.custom_fake = obtener_prioridad_base;
+    TaskSetPriority_fake.custom_fake = cambiar_prioridad;
+    TaskSetBasePriority_fake.custom_fake = cambiar_prioridad_base;
+    TaskGetList_fake.custom_fake = obtener_lista;
+    TaskNext_fake.custom_fake = siguiente_tarea;
+    TaskWait_fake.custom_fake = esperar_en_lista;
+    TaskRemove_fake.custom_fake = retirar_de_lista;
+    TaskWakeup_fake.custom_fake = despertar_tarea;
+    mutex = MutexCreate(0);
+}
+
+void tearDown(void)
+{
+    // Liberación del mutex al terminar la prueba
+    MutexDestroy(mutex);
+}
+
+void test_crear_una_instancia_y_destruirla(void)
+{
+    int avaiables = MutexAvaiables();
+    eos_mutex_t mutex = MutexCreate(0);
+    TEST_ASSERT_EQUAL(avaiables - 1, MutexAvaiables());
+    TEST_ASSERT_NOT_NULL(mutex);
+    MutexDestroy(mutex);
+    TEST_ASSERT_EQUAL(avaiables, MutexAvaiables());
+}
+
+void test_tomar_un_mutex_libre(void)
+{
+    // Cuando se toma un mutex libre entonces la tarea no se bloquea
+    TEST_ASSERT_TRUE(tomar(mutex, BAJA));
+    TEST_ASSERT_EQUAL(0, TaskWait_fake.call_count);
+}
+
+void test_tomar_un_mutex_en_forma_recursiva(void)
+{
+    // Cuando el dueño toma dos veces el mutex
+    TEST_ASSERT_TRUE(tomar(mutex, BAJA));
+    TEST_ASSERT_TRUE(tomar(mutex, BAJA));
+    // Entonces despues de liberarlo una vez otra tarea no lo puede tomar
+    TEST_ASSERT_TRUE(liberar(mutex, BAJA));
+    TEST_ASSERT_FALSE(tomar(mutex, ALTA));
+    TEST_ASSERT_EQUAL(1, TaskWait_fake.call_count);
+    // Y al liberarlo por segunda vez se le entrega a la tarea que lo esperaba
+    TEST_ASSERT_TRUE(liberar(mutex, BAJA));
+    TEST_ASSERT_EQUAL(1, TaskWakeup_fake.call_count);
+    TEST_ASSERT_EQUAL_PTR(TAREA(ALTA), TaskWakeup_fake.arg0_val);
+    TEST_ASSERT_TRUE(TaskWakeup_fake.arg1_val);
+}
+
+void test_liberar_un_mutex_de_otra_tarea(void)
+{
+    // Cuando una tarea libera un mutex que no le pertenece entonces se informa el error
+    tomar(mutex, BAJA);
+    TEST_ASSERT_FALSE(liberar(mutex, ALTA));
+    // Y el mutex sigue perteneciendo a la tarea que lo tomó
+    TEST_ASSERT_FALSE(tomar(mutex, MEDIA));
+}
+
+void test_heredar_la_prioridad_de_la_tarea_que_espera(void)
+{
+    // Cuando una tarea de alta prioridad espera un mutex de una tarea de baja prioridad
+    tomar(mutex, BAJA);
+    TEST_ASSERT_FALSE(tomar(mutex, ALTA));
+    // Entonces el dueño del mutex hereda la prioridad de la tarea que espera
+    TEST_ASSERT_EQUAL(ALTA, tareas[BAJA].prioridad);
+    // Y al liberar el mutex recupera su prioridad
+    liberar(mutex, BAJA);
+    TEST_ASSERT_EQUAL(BAJA, tareas[BAJA].prioridad);
+}
+
+void test_heredar_la_prioridad_en_forma_transitiva(void)
+{
+    // Cuando la tarea de media prioridad espera un mutex de la tarea de baja prioridad
+    eos_mutex_t otro = MutexCreate(0);
+    tomar(mutex, BAJA);
+    tomar(otro, MEDIA);
+    tomar(mutex, MEDIA);
+    // Y la tarea de alta prioridad espera un mutex de la tarea de media prioridad
+    tomar(otro, ALTA);
+    // Entonces ambas tareas heredan la prioridad de la tarea de alta prioridad
+    TEST_ASSERT_EQUAL(ALTA, tareas[MEDIA].prioridad);
+    TEST_ASSERT_EQUAL(ALTA, tareas[BAJA].prioridad);
+    MutexDestroy(otro);
+}
+
+void test_entregar_el_mutex_a_la_tarea_de_mayor_prioridad(void)
+{
+    // Cuando una tarea de media y despues una de alta prioridad esperan el mutex
+    tomar(mutex, BAJA);
+    tomar(mutex, MEDIA);
+    tomar(mutex, ALTA);
+    // Entonces al liberarlo se entrega a la tarea de alta prioridad
+    liberar(mutex, BAJA);
+    TEST_ASSERT_EQUAL_PTR(TAREA(ALTA), TaskWakeup_fake.arg0_val);
+    // Y el nuevo dueño hereda la prioridad de la tarea que sigue esperando
+    TEST_ASSERT_TRUE(liberar(mutex, ALTA));
+    TEST_ASSERT_EQUAL_PTR(TAREA(MEDIA), TaskWakeup_fake.arg0_val);
+}
+
+void test_recuperar_la_prioridad_heredada_por_otro_mutex(void)
+{
+    // Cuando la tarea de baja prioridad posee dos mutex que esperan las otras tareas
+    eos_mutex_t otro = MutexCreate(0);
+    tomar(mutex, BAJA);
+    tomar(otro, BAJA);
+    tomar(otro, MEDIA);
+    tomar(mutex, ALTA);
+    // Entonces al liberar el mutex que espera la tarea de alta prioridad conserva la prioridad
+    // heredada de la tarea de media prioridad
+    liberar(mutex, BAJA);
+    TEST_ASSERT_EQUAL(MEDIA, tareas[BAJA].prioridad);
+    MutexDestroy(otro);
+}
+
+void test_elevar_al_techo_de_prioridad_al_tomar_el_mutex(void)
+{
+    // Cuando una tarea toma un mutex con techo de prioridad
+    eos_mutex_t techo = MutexCreate(ALTA);
+    TEST_ASSERT_TRUE(tomar(techo, BAJA));
+    // Entonces se eleva en forma inmediata hasta el techo
+    TEST_ASSERT_EQUAL(ALTA, tareas[BAJA].prioridad);
+    // Y al liberar el mutex recupera su prioridad
+    TEST_ASSERT_TRUE(liberar(techo, BAJA));
+    TEST_ASSERT_EQUAL(BAJA, tareas[BAJA].prioridad);
+    MutexDestroy(techo);
+}
+
+void test_conservar_el_techo_de_otro_mutex_al_liberar(void)
+{
+    // Cuando una tarea toma dos mutex con techos de prioridad diferentes
+    eos_mutex_t media = MutexCreate(MEDIA);
+    eos_mutex_t alta = MutexCreate(ALTA);
+    tomar(media, BAJA);
+    tomar(alta, BAJA);
+    // Entonces al liberar el de techo mas alto conserva el techo del otro mutex
+    liberar(alta, BAJA);
+    TEST_ASSERT_EQUAL(MEDIA, tareas[BAJA].prioridad);
+    liberar(media, BAJA);
+    TEST_ASSERT_EQUAL(BAJA, tareas[BAJA].prioridad);
+    MutexDestroy(media);
+    MutexDestroy(alta);
+}
+
+void test_informar_un_techo_inferior_a_la_prioridad_de_la_tarea(void)
+{
+    // Cuando una tarea toma un mutex con un techo inferior a su prioridad
+    eos_mutex_t techo = MutexCreate(MEDIA);
+    tomar(techo, ALTA);
+    // Entonces se informa el error de configuración del techo
+    TEST_ASSERT_EQUAL(1, EosOnErrorCallback_fake.call_count);
+    TEST_ASSERT_EQUAL(EOS_ERRROR_MUTEX_CEILING, EosOnErrorCallback_fake.arg0_val);
+    // Y la tarea conserva su prioridad
+    TEST_ASSERT_EQUAL(ALTA, tareas[ALTA].prioridad);
+    TEST_ASSERT_EQUAL(0, TaskSetPriority_fake.call_count);
+    MutexDestroy(techo);
+}
+
+void test_anidar_un_mutex_con_un_techo_inferior_al_de_otro_mutex(void)
+{
+    // Cuando una tarea que posee un mutex con techo toma otro mutex con un techo inferior
+    eos_mutex_t media = MutexCreate(MEDIA);
+    eos_mutex_t alta = MutexCreate(ALTA);
+    tomar(alta, BAJA);
+    TEST_ASSERT_TRUE(tomar(media, BAJA));
+    // Entonces no se informa un error porque la prioridad asignada no supera ningun techo
+    TEST_ASSERT_EQUAL(0, EosOnErrorCallback_fake.call_count);
+    TEST_ASSERT_EQUAL(ALTA, tareas[BAJA].prioridad);
+    MutexDestroy(media);
+    MutexDestroy(alta);
+}
+
+void test_entregar_un_mutex_con_techo_a_la_tarea_que_espera(void)
+{
+    // Cuando una tarea espera un mutex con techo que otra tarea posee
+    eos_mutex_t techo = MutexCreate(ALTA);
+    tomar(techo, BAJA);
+    TEST_ASSERT_FALSE(tomar(techo, MEDIA));
+    // Entonces al liberarlo la tarea que lo recibe se eleva hasta el techo
+    liberar(techo, BAJA);
+    TEST_ASSERT_EQUAL_PTR(TAREA(MEDIA), TaskWakeup_fake.arg0_val);
+    TEST_ASSERT_EQUAL(ALTA, tareas[MEDIA].prioridad);
+    TEST_ASSERT_EQUAL(BAJA, tareas[BAJA].prioridad);
+    MutexDestroy(techo);
+}
+
+void test_cambiar_la_prioridad_de_una_tarea_sin_mutex(void)
+{
+    // Cuando se cambia la prioridad de una tarea que no posee mutex
+    MutexSetBasePriority(TAREA(BAJA), MEDIA);
+    // Entonces cambian la prioridad asignada y la prioridad efectiva
+    TEST_ASSERT_EQUAL(MEDIA, tareas[BAJA].base);
+    TEST_ASSERT_EQUAL(MEDIA, tareas[BAJA].prioridad);
+}
+
+void test_conservar_la_herencia_al_reducir_la_prioridad(void)
+{
+    // Cuando se reduce la prioridad de una tarea que heredó la prioridad de otra
+    tomar(mutex, MEDIA);
+    tomar(mutex, ALTA);
+    MutexSetBasePriority(TAREA(MEDIA), BAJA);
+    // Entonces la tarea conserva la prioridad heredada
+    TEST_ASSERT_EQUAL(ALTA, tareas[MEDIA].prioridad);
+    // Y al liberar el mutex se ejecuta con la nueva prioridad asignada
+    liberar(mutex, MEDIA);
+    TEST_ASSERT_EQUAL(BAJA, tareas[MEDIA].prioridad);
+}
+
+void test_propagar_el_aumento_de_prioridad_de_una_tarea_que_espera(void)
+{
+    // Cuando aumenta la prioridad de una tarea que espera un mutex
+    tomar(mutex, BAJA);
+    tomar(mutex, MEDIA);
+    MutexSetBasePriority(TAREA(MEDIA), ALTA);
+    // Entonces el dueño del mutex hereda la nueva prioridad
+    TEST_ASSERT_EQUAL(ALTA, tareas[MEDIA].prioridad);
+    TEST_ASSERT_EQUAL(ALTA, tareas[BAJA].prioridad);
+}
+
+void test_propagar_la_reduccion_de_prioridad_de_una_tarea_que_espera(void)
+{
+    // Cuando se reduce la prioridad de una tarea de alta prioridad que espera un mutex
+    eos_mutex_t otro = MutexCreate(0);
+    tomar(mutex, BAJA);
+    tomar(otro, MEDIA);
+    tomar(mutex, MEDIA);
+    tomar(otro, ALTA);
+    MutexSetBasePriority(TAREA(ALTA), BAJA);
+    // Entonces los dueños de la cadena dejan de heredar la prioridad anterior
+    TEST_ASSERT_EQUAL(BAJA, tareas[ALTA].prioridad);
+    TEST_ASSERT_EQUAL(MEDIA, tareas[MEDIA].prioridad);
+    TEST_ASSERT_EQUAL(MEDIA, tareas[BAJA].prioridad);
+    MutexDestroy(otro);
+}
+
+void test_recuperar_la_prioridad_al_vencer_la_espera(void)
+{
+    // Cuando vence la espera de una tarea de alta prioridad que esperaba un mutex
+    tomar(mutex, BAJA);
+    tomar(mutex, ALTA);
+    MutexWaitTimeout(TAREA(ALTA));
+    // Entonces la tarea se retira de la lista de espera
+    TEST_ASSERT_NULL(tareas[ALTA].lista);
+    // Y el dueño del mutex recupera su prioridad
+    TEST_ASSERT_EQUAL(BAJA, tareas[BAJA].prioridad);
+    // Y al liberar el mutex no se despierta ninguna tarea
+    liberar(mutex, BAJA);
+    TEST_ASSERT_EQUAL(0, TaskWakeup_fake.call_count);
+}
+
+void test_recuperar_la_prioridad_en_forma_transitiva_al_vencer_la_espera(void)
+{
+    // Cuando la tarea de media prioridad espera un mutex de la tarea de baja prioridad
+    eos_mutex_t otro = MutexCreate(0);
+    tomar(mutex, BAJA);
+    tomar(otro, MEDIA);
+    tomar(mutex, MEDIA);
+    // Y vence la espera de la tarea de alta prioridad en un mutex de la tarea de media prioridad
+    tomar(otro, ALTA);
+    MutexWaitTimeout(TAREA(ALTA));
+    // Entonces ambos dueños recuperan la prioridad que les corresponde sin la tarea que esperaba
+    TEST_ASSERT_EQUAL(MEDIA, tareas[MEDIA].prioridad);
+    TEST_ASSERT_EQUAL(MEDIA, tareas[BAJA].prioridad);
+    MutexDestroy(otro);
+}
+
+void test_vencer_la_espera_de_una_tarea_sin_mutex(void)
+{
+    // Cuando vence la espera de una tarea que no esperaba un mutex
+    MutexWaitTimeout(TAREA(MEDIA));
+    // Entonces no cambia ninguna prioridad
+    TEST_ASSERT_EQUAL(0, TaskRemove_fake.call_count);
+    TEST_ASSERT_EQUAL(0, TaskSetPriority_fake.call_count);
+}
+
+void test_degradar_una_tarea_sin_mutex(void)
+{
+    // Cuando se degrada una tarea que no posee ningún mutex
+    TEST_ASSERT_FALSE(MutexDemote(TAREA(MEDIA)));
+    // Entonces no cambia su prioridad
+    TEST_ASSERT_EQUAL(0, TaskSetPriority_fake.call_count);
+}
+
+void test_degradar_a_la_tarea_que_posee_un_mutex(void)
+{
+    // Cuando se degrada a la tarea de media prioridad que posee un mutex que nadie espera
+    tomar(mutex, MEDIA);
+    TaskBudgetExhausted_fake.return_val = true;
+    TEST_ASSERT_TRUE(MutexDemote(TAREA(MEDIA)));
+    // Entonces pierde su prioridad asignada
+    TEST_ASSERT_EQUAL(0, tareas[MEDIA].prioridad);
+    // Y la recupera al liberar el mutex
+    liberar(mutex, MEDIA);
+    TEST_ASSERT_EQUAL(MEDIA, tareas[MEDIA].prioridad);
+}
+
+void test_conservar_la_herencia_al_degradar_una_tarea(void)
+{
+    // Cuando la tarea de alta prioridad espera un mutex de la tarea de media prioridad
+    tomar(mutex, MEDIA);
+    tomar(mutex, ALTA);
+    // Y se degrada a la tarea de media prioridad
+    TaskBudgetExhausted_fake.return_val = true;
+    TEST_ASSERT_TRUE(MutexDemote(TAREA(MEDIA)));
+    // Entonces conserva la prioridad heredada de la tarea que espera
+    TEST_ASSERT_EQUAL(ALTA, tareas[MEDIA].prioridad);
+}
+
+void test_mantener_la_degradacion_cuando_llega_una_tarea_a_esperar(void)
+{
+    // Cuando se degrada a la tarea de media prioridad que posee un mutex
+    tomar(mutex, MEDIA);
+    TaskBudgetExhausted_fake.return_val = true;
+    TEST_ASSERT_TRUE(MutexDemote(TAREA(MEDIA)));
+    // Y despues la tarea de baja prioridad empieza a esperar el mutex
+    tomar(mutex, BAJA);
+    // Entonces la tarea de media prioridad sigue sin su prioridad asignada
+    TEST_ASSERT_EQUAL(BAJA, tareas[MEDIA].prioridad);
+}
+
+void test_recuperar_la_prioridad_despues_de_reponer_el_presupuesto(void)
+{
+    // Cuando se degrada a la tarea de media prioridad que posee un mutex
+    tomar(mutex, MEDIA);
+    TaskBudgetExhausted_fake.return_val = true;
+    TEST_ASSERT_TRUE(MutexDemote(TAREA(MEDIA)));
+    // Y despues de reponerse su presupuesto la tarea de baja prioridad espera el mutex
+    TaskBudgetExhausted_fake.return_val = false;
+    tomar(mutex, BAJA);
+    // Entonces la tarea de media prioridad recupera su prioridad asignada
+    TEST_ASSERT_EQUAL(MEDIA, tareas[MEDIA].prioridad);
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,130 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file test_periodicas.c
+ ** @brief Pruebas unitarias de los trabajos de las tareas periodicas
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "unity.h"
+#include "periodicas.h"
+#include "mock_eos_api.h"
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Periodo de la tarea periodica usada en las pruebas
+#define PERIODO 20
+
+//! Plazo relativo de la tarea periodica usada en las pruebas
+#define PLAZO 10
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Variable con los tiempos de los trabajos de la tarea periodica usada en las pruebas
+static struct periodic_s periodica[1];
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void setUp(void)
+{
+    FFF_RESET_HISTORY();
+}
+
+void tearDown(void)
+{
+}
+
+void test_terminar_el_primer_trabajo_dentro_del_plazo(void)
+{
+    // Cuando la tarea se crea en el tick 100 y su primer trabajo termina en el tick 110
+    PeriodicStart(periodica, PERIODO, 100);
+    TEST_ASSERT_FALSE(PeriodicComplete(periodica, PLAZO, 100 + PLAZO));
+    // Entonces no se registra ningun plazo vencido
+    TEST_ASSERT_EQUAL(0, periodica->misses);
+    TEST_ASSERT_EQUAL(0, EosOnErrorCallback_fake.call_count);
+}
+
+void test_el_primer_trabajo_vence_desde_la_creacion_de_la_tarea(void)
+{
+    // Cuando la tarea se crea en el tick 100 pero recibe el procesador por primera vez en el 105
+    PeriodicStart(periodica, PERIODO, 100);
+    // Y su primer trabajo termina en el tick 111, dentro del plazo contado desde el 105
+    TEST_ASSERT_TRUE(PeriodicComplete(periodica, PLAZO, 111));
+    // Entonces se registra el plazo vencido porque se cuenta desde la creación
+    TEST_ASSERT_EQUAL(1, periodica->misses);
+    TEST_ASSERT_EQUAL(1, EosOnErrorCallback_fake.call_count);
+    TEST_ASSERT_EQUAL(EOS_ERRROR_DEADLINE_MISS, EosOnErrorCallback_fake.arg0_val);
+}
+
+void test_los_trabajos_siguientes_vencen_desde_su_liberacion(void)
+{
+    // Cuando se libera el segundo trabajo un periodo despues del primero
+    PeriodicStart(periodica, PERIODO, 100);
+    PeriodicComplete(periodica, PLAZO, 105);
+    periodica->release += periodica->period;
+    // Entonces su plazo se cuenta desde su propia liberación
+    TEST_ASSERT_FALSE(PeriodicComplete(periodica, PLAZO, 120 + PLAZO));
+    TEST_ASSERT_TRUE(PeriodicComplete(periodica, PLAZO, 121 + PLAZO));
+    TEST_ASSERT_EQUAL(1, periodica->misses);
+}
+
+void test_comparar_plazos_con_desborde_del_contador_de_ticks(void)
+{
+    // Cuando el trabajo se libera antes del desborde del contador de ticks y termina despues
+    PeriodicStart(periodica, PERIODO, UINT32_MAX - 2);
+    // Entonces el plazo se compara con la cantidad de ticks transcurridos
+    TEST_ASSERT_FALSE(PeriodicComplete(periodica, PLAZO, PLAZO - 3));
+    TEST_ASSERT_TRUE(PeriodicComplete(periodica, PLAZO, PLAZO - 2));
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
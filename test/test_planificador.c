@@ -0,0 +1,268 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file test_planificador.c
+ ** @brief Pruebas unitarias del planificador por prioridades con mapa de bits
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "unity.h"
+#include "planificador.h"
+#include "mock_tareas.h"
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Macro para obtener el descriptor de una de las tareas simuladas
+#define TAREA(indice) ((eos_task_t)&tareas[indice])
+
+//! Menor prioridad que se puede asignar a una tarea
+#define MINIMA 0
+
+//! Mayor prioridad que se puede asignar a una tarea
+#define MAXIMA (EOS_MAX_PRIORITY - 1)
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Estructura con el estado de una tarea simulada
+typedef struct tarea_simulada_s {
+    //! Lista de tareas listas en la que esta encolada la tarea
+    task_list_t lista;
+    //! Tarea siguiente en la lista de tareas listas
+    struct tarea_simulada_s* siguiente;
+} * tarea_simulada_t;
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Vector con el estado de las tareas simuladas, una mas que la cantidad de prioridades
+static struct tarea_simulada_s tareas[EOS_MAX_PRIORITY + 1];
+
+//! Variable que simula el descriptor de la tarea inactiva
+static int tarea_inactiva[1];
+
+//! Descriptor de la tarea inactiva durante las pruebas
+static eos_task_t const INACTIVA = (eos_task_t)tarea_inactiva;
+
+//! Variable con la instancia del planificador usado para las pruebas
+static scheduler_t planificador;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+//! Implementación simulada de la inserción de una tarea al final de una lista
+void encolar_tarea(task_list_t list, eos_task_t task)
+{
+    tarea_simulada_t tarea = (tarea_simulada_t)task;
+
+    tarea->lista = list;
+    tarea->siguiente = NULL;
+    if (list->last) {
+        ((tarea_simulada_t)list->last)->siguiente = tarea;
+    } else {
+        list->first = task;
+    }
+    list->last = task;
+}
+
+//! Implementación simulada del retiro de una tarea de la lista en la que esta encolada
+void retirar_tarea(eos_task_t task)
+{
+    tarea_simulada_t tarea = (tarea_simulada_t)task;
+    task_list_t list = tarea->lista;
+    tarea_simulada_t anterior = NULL;
+
+    if (list) {
+        for (tarea_simulada_t actual = (tarea_simulada_t)list->first; actual != tarea;
+             actual = actual->siguiente) {
+            anterior = actual;
+        }
+        if (anterior) {
+            anterior->siguiente = tarea->siguiente;
+        } else {
+            list->first = (eos_task_t)tarea->siguiente;
+        }
+        if (list->last == task) {
+            list->last = (eos_task_t)anterior;
+        }
+        tarea->lista = NULL;
+        tarea->siguiente = NULL;
+    }
+}
+
+//! Implementación simulada de la extracción de la primera tarea de una lista
+eos_task_t extraer_tarea(task_list_t list)
+{
+    eos_task_t task = list->first;
+
+    if (task) {
+        retirar_tarea(task);
+    }
+    return task;
+}
+
+//! Función auxiliar para retirar todas las tareas listas del planificador
+static void vaciar(void)
+{
+    while (Schedule(planificador) != INACTIVA) {
+    }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void setUp(void)
+{
+    FFF_RESET_HISTORY();
+    TaskEnqueue_fake.custom_fake = encolar_tarea;
+    TaskRemove_fake.custom_fake = retirar_tarea;
+    TaskDequeue_fake.custom_fake = extraer_tarea;
+    planificador = SchedulerCreate(INACTIVA, 0);
+    vaciar();
+}
+
+void tearDown(void)
+{
+}
+
+void test_sin_tareas_listas_se_ejecuta_la_tarea_inactiva(void)
+{
+    for (int prioridad = MINIMA; prioridad <= MAXIMA; prioridad++) {
+        TEST_ASSERT_FALSE(SchedulerHasReady(planificador, prioridad));
+    }
+    TEST_ASSERT_EQUAL_PTR(INACTIVA, Schedule(planificador));
+}
+
+void test_ejecutar_las_tareas_en_orden_de_prioridad(void)
+{
+    // Cuando se encola una tarea en cada prioridad, alternando prioridades bajas y altas
+    for (int indice = 0; indice < EOS_MAX_PRIORITY; indice++) {
+        int prioridad = (indice % 2) ? MAXIMA - indice / 2 : indice / 2;
+        SchedulerEnqueue(planificador, TAREA(prioridad), prioridad);
+        TEST_ASSERT_TRUE(SchedulerHasReady(planificador, prioridad));
+    }
+    // Entonces se ejecutan desde la mayor prioridad hasta la menor
+    for (int prioridad = MAXIMA; prioridad >= MINIMA; prioridad--) {
+        TEST_ASSERT_EQUAL_PTR(TAREA(prioridad), Schedule(planificador));
+    }
+    TEST_ASSERT_EQUAL_PTR(INACTIVA, Schedule(planificador));
+}
+
+void test_respetar_el_orden_de_llegada_con_prioridades_iguales(void)
+{
+    // Cuando se encolan tareas con la misma prioridad
+    SchedulerEnqueue(planificador, TAREA(2), 5);
+    SchedulerEnqueue(planificador, TAREA(0), 5);
+    SchedulerEnqueue(planificador, TAREA(1), 5);
+    // Entonces se ejecutan por orden de llegada
+    TEST_ASSERT_EQUAL_PTR(TAREA(2), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(TAREA(0), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(TAREA(1), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(INACTIVA, Schedule(planificador));
+}
+
+void test_tratar_una_prioridad_fuera_de_rango_como_la_mayor(void)
+{
+    // Cuando se encola una tarea con una prioridad mayor a la maxima permitida
+    SchedulerEnqueue(planificador, TAREA(0), MAXIMA);
+    SchedulerEnqueue(planificador, TAREA(1), EOS_MAX_PRIORITY);
+    // Entonces comparte la cola de la mayor prioridad
+    TEST_ASSERT_TRUE(SchedulerHasReady(planificador, EOS_MAX_PRIORITY));
+    TEST_ASSERT_EQUAL_PTR(TAREA(0), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(TAREA(1), Schedule(planificador));
+}
+
+void test_limpiar_la_prioridad_al_ejecutar_su_ultima_tarea(void)
+{
+    // Cuando hay dos tareas listas con la misma prioridad
+    SchedulerEnqueue(planificador, TAREA(0), 3);
+    SchedulerEnqueue(planificador, TAREA(1), 3);
+    // Entonces la prioridad sigue con tareas listas despues de ejecutar la primera
+    TEST_ASSERT_EQUAL_PTR(TAREA(0), Schedule(planificador));
+    TEST_ASSERT_TRUE(SchedulerHasReady(planificador, 3));
+    // Y queda sin tareas listas despues de ejecutar la ultima
+    TEST_ASSERT_EQUAL_PTR(TAREA(1), Schedule(planificador));
+    TEST_ASSERT_FALSE(SchedulerHasReady(planificador, 3));
+}
+
+void test_limpiar_la_prioridad_al_retirar_su_ultima_tarea(void)
+{
+    // Cuando se retiran las tareas listas de una prioridad
+    SchedulerEnqueue(planificador, TAREA(0), MINIMA);
+    SchedulerEnqueue(planificador, TAREA(1), MINIMA);
+    SchedulerEnqueue(planificador, TAREA(2), MAXIMA);
+    SchedulerRemove(planificador, TAREA(1), MINIMA);
+    TEST_ASSERT_TRUE(SchedulerHasReady(planificador, MINIMA));
+    SchedulerRemove(planificador, TAREA(0), MINIMA);
+    // Entonces la prioridad queda sin tareas listas y no se modifican las demas
+    TEST_ASSERT_FALSE(SchedulerHasReady(planificador, MINIMA));
+    TEST_ASSERT_EQUAL_PTR(TAREA(2), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(INACTIVA, Schedule(planificador));
+}
+
+void test_consultar_tareas_listas_de_mayor_prioridad(void)
+{
+    // Cuando hay una tarea lista con una prioridad intermedia
+    SchedulerEnqueue(planificador, TAREA(0), 10);
+    // Entonces solo desaloja a las tareas de menor prioridad
+    TEST_ASSERT_TRUE(SchedulerHasReadyAbove(planificador, MINIMA));
+    TEST_ASSERT_TRUE(SchedulerHasReadyAbove(planificador, 9));
+    TEST_ASSERT_FALSE(SchedulerHasReadyAbove(planificador, 10));
+    TEST_ASSERT_FALSE(SchedulerHasReadyAbove(planificador, 11));
+}
+
+void test_nada_supera_a_la_mayor_prioridad(void)
+{
+    // Cuando hay tareas listas en todas las prioridades
+    for (int prioridad = MINIMA; prioridad <= MAXIMA; prioridad++) {
+        SchedulerEnqueue(planificador, TAREA(prioridad), prioridad);
+    }
+    // Entonces ninguna desaloja a una tarea de la mayor prioridad, que usa la cola 0
+    TEST_ASSERT_FALSE(SchedulerHasReadyAbove(planificador, MAXIMA));
+    TEST_ASSERT_FALSE(SchedulerHasReadyAbove(planificador, EOS_MAX_PRIORITY));
+    TEST_ASSERT_TRUE(SchedulerHasReadyAbove(planificador, MAXIMA - 1));
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,235 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file test_planificador_edf.c
+ ** @brief Pruebas unitarias del planificador por vencimiento del plazo mas proximo
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   3 | 2026.10.16 | evolentini      | Retiro de tareas listas sin recorrer el monticulo       |
+ **|   2 | 2026.10.16 | evolentini      | Particiones de tiempo con un planificador cada una      |
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "unity.h"
+#include "planificador.h"
+#include "mock_tareas.h"
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Macro para obtener el descriptor de una de las tareas simuladas
+#define TAREA(indice) ((eos_task_t)&plazos[indice])
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Indices de las tareas simuladas
+enum { PRIMERA, SEGUNDA, TERCERA, TAREAS };
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Vector con los vencimientos de los plazos de las tareas simuladas
+static uint32_t plazos[TAREAS];
+
+//! Vector con las posiciones de las tareas simuladas en el monticulo del planificador
+static uint32_t indices[TAREAS];
+
+//! Variable que simula el descriptor de la tarea inactiva
+static int tarea_inactiva[1];
+
+//! Descriptor de la tarea inactiva durante las pruebas
+static eos_task_t const INACTIVA = (eos_task_t)tarea_inactiva;
+
+//! Variable con la instancia del planificador usado para las pruebas
+static scheduler_t planificador;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+//! Implementación simulada del vencimiento del plazo de una tarea
+uint32_t obtener_plazo(eos_task_t task)
+{
+    return *(uint32_t*)task;
+}
+
+//! Implementación simulada del registro de la posición de una tarea en el monticulo
+void guardar_indice(eos_task_t task, uint32_t index)
+{
+    indices[(uint32_t*)task - plazos] = index;
+}
+
+//! Implementación simulada de la consulta de la posición de una tarea en el monticulo
+uint32_t obtener_indice(eos_task_t task)
+{
+    return indices[(uint32_t*)task - plazos];
+}
+
+//! Función auxiliar para retirar todas las tareas listas del planificador
+static void vaciar(void)
+{
+    while (Schedule(planificador) != INACTIVA) {
+    }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void setUp(void)
+{
+    FFF_RESET_HISTORY();
+    TaskGetDeadline_fake.custom_fake = obtener_plazo;
+    TaskSetReadyIndex_fake.custom_fake = guardar_indice;
+    TaskGetReadyIndex_fake.custom_fake = obtener_indice;
+    planificador = SchedulerCreate(INACTIVA, 0);
+    vaciar();
+}
+
+void tearDown(void)
+{
+}
+
+void test_sin_tareas_listas_se_ejecuta_la_tarea_inactiva(void)
+{
+    TEST_ASSERT_FALSE(SchedulerHasReady(planificador, 0));
+    TEST_ASSERT_EQUAL_PTR(INACTIVA, Schedule(planificador));
+}
+
+void test_ejecutar_la_tarea_con_el_plazo_mas_proximo(void)
+{
+    // Cuando se encolan tareas con diferentes plazos sin importar su prioridad
+    plazos[PRIMERA] = 300;
+    plazos[SEGUNDA] = 100;
+    plazos[TERCERA] = 200;
+    SchedulerEnqueue(planificador, TAREA(PRIMERA), 3);
+    SchedulerEnqueue(planificador, TAREA(SEGUNDA), 1);
+    SchedulerEnqueue(planificador, TAREA(TERCERA), 2);
+    // Entonces se ejecutan en el orden de vencimiento de sus plazos
+    TEST_ASSERT_TRUE(SchedulerHasReady(planificador, 0));
+    TEST_ASSERT_EQUAL_PTR(TAREA(SEGUNDA), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(TAREA(TERCERA), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(TAREA(PRIMERA), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(INACTIVA, Schedule(planificador));
+}
+
+void test_respetar_el_orden_de_llegada_con_plazos_iguales(void)
+{
+    // Cuando se encolan tareas con el mismo plazo
+    plazos[PRIMERA] = 100;
+    plazos[SEGUNDA] = 100;
+    plazos[TERCERA] = 100;
+    SchedulerEnqueue(planificador, TAREA(TERCERA), 0);
+    SchedulerEnqueue(planificador, TAREA(PRIMERA), 0);
+    SchedulerEnqueue(planificador, TAREA(SEGUNDA), 0);
+    // Entonces se ejecutan por orden de llegada
+    TEST_ASSERT_EQUAL_PTR(TAREA(TERCERA), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(TAREA(PRIMERA), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(TAREA(SEGUNDA), Schedule(planificador));
+}
+
+void test_comparar_plazos_con_desborde_del_contador_de_ticks(void)
+{
+    // Cuando el plazo de una tarea vence despues del desborde del contador de ticks
+    plazos[PRIMERA] = 10;
+    plazos[SEGUNDA] = UINT32_MAX - 10;
+    SchedulerEnqueue(planificador, TAREA(PRIMERA), 0);
+    SchedulerEnqueue(planificador, TAREA(SEGUNDA), 0);
+    // Entonces se ejecuta primero la tarea cuyo plazo vence antes del desborde
+    TEST_ASSERT_EQUAL_PTR(TAREA(SEGUNDA), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(TAREA(PRIMERA), Schedule(planificador));
+}
+
+void test_retirar_una_tarea_lista(void)
+{
+    // Cuando se retira la tarea con el plazo mas proximo
+    plazos[PRIMERA] = 100;
+    plazos[SEGUNDA] = 200;
+    plazos[TERCERA] = 300;
+    SchedulerEnqueue(planificador, TAREA(PRIMERA), 0);
+    SchedulerEnqueue(planificador, TAREA(SEGUNDA), 0);
+    SchedulerEnqueue(planificador, TAREA(TERCERA), 0);
+    SchedulerRemove(planificador, TAREA(PRIMERA), 0);
+    // Entonces se ejecutan las demas tareas en orden
+    TEST_ASSERT_EQUAL_PTR(TAREA(SEGUNDA), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(TAREA(TERCERA), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(INACTIVA, Schedule(planificador));
+}
+
+void test_retirar_una_tarea_del_medio_del_monticulo(void)
+{
+    // Cuando se retira una tarea que no tiene el plazo mas proximo
+    plazos[PRIMERA] = 100;
+    plazos[SEGUNDA] = 200;
+    plazos[TERCERA] = 300;
+    SchedulerEnqueue(planificador, TAREA(TERCERA), 0);
+    SchedulerEnqueue(planificador, TAREA(PRIMERA), 0);
+    SchedulerEnqueue(planificador, TAREA(SEGUNDA), 0);
+    SchedulerRemove(planificador, TAREA(TERCERA), 0);
+    // Entonces solo se retira esa tarea y las demas conservan su orden
+    TEST_ASSERT_EQUAL_PTR(TAREA(PRIMERA), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(TAREA(SEGUNDA), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(INACTIVA, Schedule(planificador));
+}
+
+void test_retirar_una_tarea_que_no_esta_lista(void)
+{
+    // Cuando se retira una tarea que ya fue seleccionada por el planificador
+    plazos[PRIMERA] = 100;
+    plazos[SEGUNDA] = 200;
+    SchedulerEnqueue(planificador, TAREA(PRIMERA), 0);
+    SchedulerEnqueue(planificador, TAREA(SEGUNDA), 0);
+    TEST_ASSERT_EQUAL_PTR(TAREA(PRIMERA), Schedule(planificador));
+    SchedulerRemove(planificador, TAREA(PRIMERA), 0);
+    // Entonces las tareas listas no se modifican
+    TEST_ASSERT_EQUAL_PTR(TAREA(SEGUNDA), Schedule(planificador));
+    TEST_ASSERT_EQUAL_PTR(INACTIVA, Schedule(planificador));
+}
+
+void test_cualquier_tarea_lista_puede_desalojar(void)
+{
+    // Cuando hay una tarea lista entonces puede desalojar a la tarea en ejecución
+    TEST_ASSERT_FALSE(SchedulerHasReadyAbove(planificador, 0));
+    SchedulerEnqueue(planificador, TAREA(PRIMERA), 0);
+    TEST_ASSERT_TRUE(SchedulerHasReadyAbove(planificador, EOS_MAX_PRIORITY - 1));
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
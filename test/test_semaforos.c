@@ -0,0 +1,226 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file test_semaforos.c
+ ** @brief Pruebas unitarias de los semaforos con las esperas ordenadas por prioridad
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup eos
+ ** @brief Sistema operativo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "unity.h"
+#include "semaforos.h"
+#include "mock_tareas.h"
+#include "mock_interrupciones.h"
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Macro para obtener el descriptor de una de las tareas simuladas
+#define TAREA(indice) ((eos_task_t)&tareas[indice])
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Estructura con el estado de una tarea simulada en las pruebas
+typedef struct tarea_simulada_s {
+    //! Prioridad efectiva de la tarea
+    uint8_t prioridad;
+    //! Lista de espera ordenada en la que esta bloqueada la tarea
+    task_queue_t cola;
+    //! Tarea siguiente en la lista de espera de su prioridad
+    struct tarea_simulada_s* siguiente;
+} * tarea_simulada_t;
+
+//! Indices de las tareas simuladas
+enum { PRIMERA, SEGUNDA, TERCERA, TAREAS };
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Vector con el estado de las tareas simuladas
+static struct tarea_simulada_s tareas[TAREAS];
+
+//! Variable con la tarea simulada que se esta ejecutando
+static eos_task_t activa;
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+//! Implementación simulada del bloqueo que agrega la tarea al final de la lista de su prioridad
+void esperar_en_cola(task_queue_t queue, uint32_t timeout)
+{
+    tarea_simulada_t tarea = (tarea_simulada_t)activa;
+    task_list_t list = &queue->lists[tarea->prioridad];
+
+    tarea->cola = queue;
+    tarea->siguiente = NULL;
+    if (list->last) {
+        ((tarea_simulada_t)list->last)->siguiente = tarea;
+    } else {
+        list->first = activa;
+    }
+    list->last = activa;
+    queue->waiting |= (1U << tarea->prioridad);
+}
+
+//! Implementación simulada de la búsqueda de la tarea de mayor prioridad en una lista de espera
+eos_task_t primera_en_cola(task_queue_t queue)
+{
+    eos_task_t result = NULL;
+
+    for (int prioridad = EOS_MAX_PRIORITY - 1; prioridad >= 0 && !result; prioridad--) {
+        result = queue->lists[prioridad].first;
+    }
+    return result;
+}
+
+//! Implementación simulada del desbloqueo que retira a la tarea de la lista en la que espera
+void despertar_tarea(eos_task_t task, uint32_t result)
+{
+    tarea_simulada_t tarea = (tarea_simulada_t)task;
+    task_list_t list = &tarea->cola->lists[tarea->prioridad];
+    eos_task_t* anterior;
+
+    for (anterior = &list->first; *anterior != task;) {
+        anterior = (eos_task_t*)&((tarea_simulada_t)*anterior)->siguiente;
+    }
+    *anterior = (eos_task_t)tarea->siguiente;
+    if (list->last == task) {
+        list->last = NULL;
+        for (eos_task_t actual = list->first; actual;) {
+            list->last = actual;
+            actual = (eos_task_t)((tarea_simulada_t)actual)->siguiente;
+        }
+    }
+    if (list->first == NULL) {
+        tarea->cola->waiting &= ~(1U << tarea->prioridad);
+    }
+    tarea->cola = NULL;
+    tarea->siguiente = NULL;
+}
+
+//! Función auxiliar para tomar un semaforo desde una de las tareas simuladas
+static bool tomar(eos_semaphore_t semaforo, int tarea, uint8_t prioridad)
+{
+    activa = TAREA(tarea);
+    tareas[tarea].prioridad = prioridad;
+    return SemaphoreTake(semaforo, EOS_WAIT_FOREVER);
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void setUp(void)
+{
+    FFF_RESET_HISTORY();
+    for (int indice = 0; indice < TAREAS; indice++) {
+        tareas[indice] = (struct tarea_simulada_s) { 0 };
+    }
+    TaskQueueWait_fake.custom_fake = esperar_en_cola;
+    TaskQueueFirst_fake.custom_fake = primera_en_cola;
+    TaskWakeup_fake.custom_fake = despertar_tarea;
+}
+
+void tearDown(void)
+{
+}
+
+void test_tomar_un_semaforo_disponible(void)
+{
+    eos_semaphore_t semaforo = SemaphoreCreate(1);
+
+    // Cuando el semaforo tiene unidades disponibles entonces la tarea no se bloquea
+    TEST_ASSERT_TRUE(tomar(semaforo, PRIMERA, 1));
+    TEST_ASSERT_EQUAL(0, TaskQueueWait_fake.call_count);
+    // Y cuando se agotan las unidades entonces la tarea espera en la lista ordenada
+    TEST_ASSERT_FALSE(tomar(semaforo, SEGUNDA, 1));
+    TEST_ASSERT_EQUAL(1, TaskQueueWait_fake.call_count);
+    TEST_ASSERT_EQUAL(0, TaskWait_fake.call_count);
+}
+
+void test_despertar_primero_a_la_tarea_de_mayor_prioridad(void)
+{
+    eos_semaphore_t semaforo = SemaphoreCreate(0);
+
+    // Cuando esperan el semaforo tareas de diferentes prioridades
+    tomar(semaforo, PRIMERA, 1);
+    tomar(semaforo, SEGUNDA, 3);
+    tomar(semaforo, TERCERA, 2);
+    // Entonces cada unidad se entrega a la tarea de mayor prioridad sin importar su llegada
+    SemaphoreGive(semaforo);
+    TEST_ASSERT_EQUAL_PTR(TAREA(SEGUNDA), TaskWakeup_fake.arg0_history[0]);
+    SemaphoreGive(semaforo);
+    TEST_ASSERT_EQUAL_PTR(TAREA(TERCERA), TaskWakeup_fake.arg0_history[1]);
+    SemaphoreGive(semaforo);
+    TEST_ASSERT_EQUAL_PTR(TAREA(PRIMERA), TaskWakeup_fake.arg0_history[2]);
+    TEST_ASSERT_EQUAL(3, TaskWakeup_fake.call_count);
+}
+
+void test_respetar_el_orden_de_llegada_con_prioridades_iguales(void)
+{
+    eos_semaphore_t semaforo = SemaphoreCreate(0);
+
+    // Cuando esperan el semaforo tareas de la misma prioridad
+    tomar(semaforo, TERCERA, 2);
+    tomar(semaforo, PRIMERA, 2);
+    tomar(semaforo, SEGUNDA, 2);
+    // Entonces las unidades se entregan por orden de llegada
+    SemaphoreGive(semaforo);
+    SemaphoreGive(semaforo);
+    SemaphoreGive(semaforo);
+    TEST_ASSERT_EQUAL_PTR(TAREA(TERCERA), TaskWakeup_fake.arg0_history[0]);
+    TEST_ASSERT_EQUAL_PTR(TAREA(PRIMERA), TaskWakeup_fake.arg0_history[1]);
+    TEST_ASSERT_EQUAL_PTR(TAREA(SEGUNDA), TaskWakeup_fake.arg0_history[2]);
+}
+
+void test_otorgar_sin_tareas_esperando(void)
+{
+    eos_semaphore_t semaforo = SemaphoreCreate(0);
+
+    // Cuando se otorga un semaforo que nadie espera entonces la unidad queda disponible
+    SemaphoreGive(semaforo);
+    TEST_ASSERT_EQUAL(0, TaskWakeup_fake.call_count);
+    TEST_ASSERT_TRUE(tomar(semaforo, PRIMERA, 1));
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
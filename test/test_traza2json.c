@@ -0,0 +1,234 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @file test_traza2json.c
+ ** @brief Pruebas unitarias de la herramienta que convierte el registro de eventos del nucleo
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup herramientas
+ ** @brief Herramientas de desarrollo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "unity.h"
+#include "traza2json.h"
+#include "traza.h"
+#include <string.h>
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Cantidad de eventos del registro simulado
+#define CAPACIDAD 4
+
+//! Frecuencia del contador de ciclos del registro simulado, un ciclo equivale a un microsegundo
+#define FRECUENCIA 1000000
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Volcado simulado del registro de eventos
+static uint8_t volcado[16 + 8 * CAPACIDAD];
+
+//! Traza generada por la conversión del volcado
+static char traza[4096];
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+//! Función auxiliar para almacenar un entero en formato little endian
+static void escribir(uint8_t* destino, uint32_t valor, int bytes)
+{
+    for (int indice = 0; indice < bytes; indice++) {
+        destino[indice] = (uint8_t)(valor >> (8 * indice));
+    }
+}
+
+//! Función auxiliar para completar la cabecera del registro simulado
+static void cabecera(uint32_t escritos)
+{
+    escribir(volcado, TRACE_MAGIC, 4);
+    escribir(volcado + 4, TRACE_VERSION, 2);
+    escribir(volcado + 6, CAPACIDAD, 2);
+    escribir(volcado + 8, FRECUENCIA, 4);
+    escribir(volcado + 12, escritos, 4);
+}
+
+//! Función auxiliar para almacenar un evento en una posición del registro simulado
+static void evento(int posicion, uint32_t ciclos, uint8_t tipo, uint8_t tarea, uint16_t dato)
+{
+    uint8_t* destino = volcado + 16 + 8 * posicion;
+
+    escribir(destino, ciclos, 4);
+    destino[4] = tipo;
+    destino[5] = tarea;
+    escribir(destino + 6, dato, 2);
+}
+
+//! Función auxiliar para convertir el volcado simulado y obtener la traza generada
+static int convertir(size_t bytes)
+{
+    FILE* salida = tmpfile();
+    size_t leidos;
+    int resultado;
+
+    resultado = TraceDecode(volcado, bytes, salida);
+    rewind(salida);
+    leidos = fread(traza, 1, sizeof(traza) - 1, salida);
+    traza[leidos] = 0;
+    fclose(salida);
+    return resultado;
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+void setUp(void)
+{
+    memset(volcado, 0, sizeof(volcado));
+    memset(traza, 0, sizeof(traza));
+}
+
+void tearDown(void)
+{
+}
+
+void test_rechazar_un_volcado_sin_el_identificador_del_registro(void)
+{
+    cabecera(0);
+    volcado[0] = 0;
+    TEST_ASSERT_EQUAL(1, convertir(sizeof(volcado)));
+}
+
+void test_rechazar_un_volcado_incompleto(void)
+{
+    cabecera(0);
+    TEST_ASSERT_EQUAL(1, convertir(sizeof(volcado) - 1));
+}
+
+void test_registro_vacio_genera_una_traza_sin_eventos(void)
+{
+    cabecera(0);
+    TEST_ASSERT_EQUAL(0, convertir(sizeof(volcado)));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "{\"traceEvents\":["));
+    TEST_ASSERT_NULL(strstr(traza, "\"ph\""));
+}
+
+void test_cambios_de_contexto_generan_intervalos_en_cada_tarea(void)
+{
+    cabecera(2);
+    evento(0, 100, TRACE_SWITCH, 1, 0);
+    evento(1, 110, TRACE_SWITCH, 0, 0);
+
+    TEST_ASSERT_EQUAL(0, convertir(sizeof(volcado)));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "\"args\":{\"name\":\"Tarea 1\"}"));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "\"args\":{\"name\":\"Inactiva\"}"));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "{\"ph\":\"B\",\"pid\":1,\"tid\":1,\"ts\":0.000"));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "{\"ph\":\"E\",\"pid\":1,\"tid\":1,\"ts\":10.000"));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "{\"ph\":\"B\",\"pid\":1,\"tid\":0,\"ts\":10.000"));
+    // El intervalo abierto al momento del volcado se cierra con el ultimo evento
+    TEST_ASSERT_NOT_NULL(strstr(traza, "{\"ph\":\"E\",\"pid\":1,\"tid\":0,\"ts\":10.000"));
+}
+
+void test_el_desborde_del_contador_de_ciclos_no_afecta_los_tiempos(void)
+{
+    cabecera(2);
+    evento(0, 0xFFFFFFF0, TRACE_SWITCH, 1, 0);
+    evento(1, 0x00000010, TRACE_SWITCH, 2, 0);
+
+    TEST_ASSERT_EQUAL(0, convertir(sizeof(volcado)));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "{\"ph\":\"B\",\"pid\":1,\"tid\":2,\"ts\":32.000"));
+}
+
+void test_con_el_registro_lleno_se_comienza_por_el_evento_mas_antiguo(void)
+{
+    // Se escribieron seis eventos, los dos primeros lugares tienen los eventos mas recientes
+    cabecera(6);
+    evento(0, 50, TRACE_SWITCH, 4, 0);
+    evento(1, 60, TRACE_SWITCH, 5, 0);
+    evento(2, 30, TRACE_SWITCH, 2, 0);
+    evento(3, 40, TRACE_SWITCH, 3, 0);
+
+    TEST_ASSERT_EQUAL(0, convertir(sizeof(volcado)));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "{\"ph\":\"B\",\"pid\":1,\"tid\":2,\"ts\":0.000"));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "{\"ph\":\"B\",\"pid\":1,\"tid\":5,\"ts\":30.000"));
+    TEST_ASSERT_TRUE(strstr(traza, "\"tid\":2,\"ts\":0.000") < strstr(traza, "\"tid\":3,"));
+}
+
+void test_servicios_semaforos_y_colas_generan_eventos_instantaneos(void)
+{
+    cabecera(3);
+    evento(0, 0, TRACE_SERVICE, 1, EOS_SERVICE_YIELD);
+    evento(1, 5, TRACE_SEMAPHORE_BLOCK, 1, 2);
+    evento(2, 7, TRACE_QUEUE_GIVE, 3, 1);
+
+    TEST_ASSERT_EQUAL(0, convertir(sizeof(volcado)));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "\"name\":\"YIELD\",\"args\":{\"servicio\":2}"));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "\"name\":\"SEMAPHORE_BLOCK\",\"args\":{\"semaforo\":2}"));
+    TEST_ASSERT_NOT_NULL(
+        strstr(traza, "\"tid\":3,\"ts\":7.000,\"s\":\"t\",\"name\":\"QUEUE_GIVE\""));
+}
+
+void test_el_ultimo_servicio_del_sistema_tiene_nombre(void)
+{
+    cabecera(1);
+    evento(0, 0, TRACE_SERVICE, 1, EOS_SERVICE_END - 1);
+
+    TEST_ASSERT_EQUAL(0, convertir(sizeof(volcado)));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "\"name\":\"HANDLER_LATENCY\""));
+}
+
+void test_interrupciones_generan_intervalos_en_un_hilo_propio(void)
+{
+    cabecera(2);
+    evento(0, 0, TRACE_HANDLER_ENTER, 1, 5);
+    evento(1, 3, TRACE_HANDLER_EXIT, 1, 5);
+
+    TEST_ASSERT_EQUAL(0, convertir(sizeof(volcado)));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "\"args\":{\"name\":\"IRQ 5\"}"));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "{\"ph\":\"B\",\"pid\":1,\"tid\":261,\"ts\":0.000"));
+    TEST_ASSERT_NOT_NULL(strstr(traza, "{\"ph\":\"E\",\"pid\":1,\"tid\":261,\"ts\":3.000"));
+}
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+# Copyright 2016-2021, Laboratorio de Microprocesadores
+# Facultad de Ciencias Exactas y Tecnología
+# Universidad Nacional de Tucuman
+# http://www.microprocesadores.unt.edu.ar/
+# Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+#
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+"""Perfilado estadistico del sistema operativo a partir de un volcado de muestras.
+
+Lee un volcado binario de la variable eos_profile, que se obtiene desde el depurador por ejemplo
+con "dump binary value perfil.bin eos_profile" en gdb, asigna cada muestra del contador de programa
+a la función que la contiene segun la tabla de simbolos del archivo ELF del programa e informa las
+funciones en las que el procesador ocupa mas tiempo, en total o separadas por tarea.
+
+Uso: perfil.py perfil.bin programa.elf [--tareas] [--cantidad N] [--nm arm-none-eabi-nm]
+"""
+
+import argparse
+import bisect
+import collections
+import struct
+import subprocess
+import sys
+
+# Valor que identifica al registro de muestras, "EOSP" en little endian (PROFILE_MAGIC)
+PROFILE_MAGIC = 0x50534F45
+
+# Versión del formato de los registros de muestras (PROFILE_VERSION)
+PROFILE_VERSION = 1
+
+# Formato de la cabecera: identificador, versión, capacidad, frecuencia y muestras tomadas
+HEADER = struct.Struct("<IHHII")
+
+# Formato de cada muestra: contador de programa, tarea, handler y relleno
+SAMPLE = struct.Struct("<IBBH")
+
+# Nombre con el que se informan las muestras tomadas mientras se ejecutaba el nucleo
+KERNEL = "[nucleo]"
+
+
+def leer_muestras(volcado):
+    """Devuelve la frecuencia de muestreo y la lista de muestras (pc, tarea, handler)."""
+    if len(volcado) < HEADER.size:
+        raise ValueError("el volcado no contiene un registro de muestras")
+
+    magic, version, size, frequency, written = HEADER.unpack_from(volcado)
+    if magic != PROFILE_MAGIC or version != PROFILE_VERSION:
+        raise ValueError("el volcado no contiene un registro de muestras reconocido")
+    if len(volcado) < HEADER.size + size * SAMPLE.size:
+        raise ValueError("el volcado no contiene todas las muestras del registro")
+
+    # Con el registro lleno se sobreescribieron las muestras mas antiguas
+    count = min(written, size)
+    muestras = []
+    for indice in range(count):
+        pc, task, handler, _ = SAMPLE.unpack_from(volcado, HEADER.size + indice * SAMPLE.size)
+        muestras.append((pc, task, bool(handler)))
+    return frequency, muestras
+
+
+def leer_simbolos(elf, nm):
+    """Devuelve las funciones del programa como una lista ordenada de (inicio, fin, nombre)."""
+    salida = subprocess.run([nm, "-n", "-S", "--defined-only", elf], check=True,
+                            capture_output=True, text=True).stdout
+    simbolos = []
+    for linea in salida.splitlines():
+        campos = linea.split()
+        # Las funciones thumb tienen el bit menos significativo en uno, que se descarta
+        if len(campos) == 4 and campos[2] in "tTwW":
+            inicio = int(campos[0], 16) & ~1
+            simbolos.append((inicio, inicio + int(campos[1], 16), campos[3]))
+        elif len(campos) == 3 and campos[1] in "tTwW":
+            # Un simbolo sin tamaño se extiende hasta el siguiente simbolo
+            inicio = int(campos[0], 16) & ~1
+            simbolos.append((inicio, None, campos[2]))
+
+    simbolos.sort()
+    for indice, (inicio, fin, nombre) in enumerate(simbolos):
+        if fin is None:
+            siguiente = simbolos[indice + 1][0] if indice + 1 < len(simbolos) else inicio + 1
+            simbolos[indice] = (inicio, siguiente, nombre)
+    return simbolos
+
+
+def simbolizar(pc, simbolos, inicios):
+    """Devuelve el nombre de la función que contiene la dirección de una muestra."""
+    # El bit menos significativo indica el modo thumb y no forma parte de la dirección
+    pc &= ~1
+    indice = bisect.bisect_right(inicios, pc) - 1
+    if indice >= 0 and pc < simbolos[indice][1]:
+        return simbolos[indice][2]
+    return "0x%08x" % pc
+
+
+def informar(titulo, contador, total, cantidad, salida):
+    """Escribe las funciones con mas muestras de un contador."""
+    print("\n%s: %d muestras" % (titulo, sum(contador.values())), file=salida)
+    print("%8s %8s  %s" % ("%", "muestras", "función"), file=salida)
+    for nombre, muestras in contador.most_common(cantidad):
+        print("%7.2f%% %8d  %s" % (100.0 * muestras / total, muestras, nombre), file=salida)
+
+
+def main(argumentos=None, salida=sys.stdout):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("volcado", help="volcado binario de la variable eos_profile")
+    parser.add_argument("elf", help="archivo ELF del programa que generó las muestras")
+    parser.add_argument("--tareas", action="store_true", help="informa cada tarea por separado")
+    parser.add_argument("--cantidad", type=int, default=20, help="funciones que se informan")
+    parser.add_argument("--nm", default="arm-none-eabi-nm", help="herramienta nm a utilizar")
+    opciones = parser.parse_args(argumentos)
+
+    with open(opciones.volcado, "rb") as archivo:
+        frequency, muestras = leer_muestras(archivo.read())
+    if not muestras:
+        print("El volcado no contiene muestras", file=salida)
+        return 1
+
+    simbolos = leer_simbolos(opciones.elf, opciones.nm)
+    inicios = [simbolo[0] for simbolo in simbolos]
+
+    total = collections.Counter()
+    tareas = collections.defaultdict(collections.Counter)
+    for pc, task, handler in muestras:
+        nombre = KERNEL if handler else simbolizar(pc, simbolos, inicios)
+        total[nombre] += 1
+        tareas[task][nombre] += 1
+
+    print("Muestras: %d" % len(muestras), file=salida)
+    if frequency:
+        print("Frecuencia: %d Hz, tiempo muestreado: %.3f s" %
+              (frequency, len(muestras) / frequency), file=salida)
+
+    informar("Total", total, len(muestras), opciones.cantidad, salida)
+    if opciones.tareas:
+        for task in sorted(tareas):
+            titulo = "Tarea %d" % task if task else "Inactiva"
+            informar(titulo, tareas[task], len(muestras), opciones.cantidad, salida)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
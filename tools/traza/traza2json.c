@@ -0,0 +1,393 @@
+/* Copyright 2016-2021, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2016-2021, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @file traza2json.c
+ ** @brief Herramienta que convierte el registro de eventos del nucleo en una traza de Chrome
+ **
+ ** Lee un volcado binario de la variable eos_trace y genera un archivo JSON que se puede abrir con
+ ** chrome://tracing o con https://ui.perfetto.dev para ver la linea de tiempo de las tareas y las
+ ** interrupciones. Se utiliza como "traza2json volcado.bin [traza.json]".
+ **
+ **| REV | YYYY.MM.DD | Autor           | Descripción de los cambios                              |
+ **|-----|------------|-----------------|---------------------------------------------------------|
+ **|   1 | 2026.10.16 | evolentini      | Version inicial del archivo                             |
+ **
+ ** @addtogroup herramientas
+ ** @brief Herramientas de desarrollo
+ ** @{ */
+
+/* === Inclusiones de cabeceras ================================================================ */
+
+#include "traza2json.h"
+#include "traza.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Definiciones y Macros =================================================================== */
+
+//! Cantidad de bytes de la cabecera del registro en el volcado
+#define HEADER_SIZE 16
+
+//! Cantidad de bytes de cada evento en el volcado
+#define RECORD_SIZE 8
+
+//! Cantidad de hilos posibles en la traza, uno por tarea y uno por interrupción
+#define THREAD_COUNT (TRACE_HANDLER_TID + 65536)
+
+/* === Declaraciones de tipos de datos internos ================================================ */
+
+//! Estructura con el estado de la conversión
+typedef struct decoder_s {
+    //! Archivo en el que se escribe la traza
+    FILE* output;
+    //! Indica que todavia no se escribió ningún evento en la traza
+    bool first;
+    //! Hilo de la tarea en ejecución o -1 antes del primer cambio de contexto
+    int running;
+    //! Frecuencia en Hz del contador de ciclos
+    uint32_t frequency;
+    //! Ciclos transcurridos desde el primer evento, sin los desbordes del contador
+    uint64_t cycles;
+    //! Ultimo valor del contador de ciclos
+    uint32_t time;
+    //! Indica para cada hilo si ya se escribió su nombre
+    bool named[THREAD_COUNT];
+    //! Cantidad de intervalos abiertos en cada hilo
+    uint8_t open[THREAD_COUNT];
+} * decoder_t;
+
+/* === Declaraciones de funciones internas ===================================================== */
+
+/**
+ * @brief Función para leer un entero de 16 bits almacenado en formato little endian
+ *
+ * @param[in] data      Puntero al primer byte del entero
+ * @return              Valor del entero
+ */
+static uint16_t Read16(const uint8_t* data);
+
+/**
+ * @brief Función para leer un entero de 32 bits almacenado en formato little endian
+ *
+ * @param[in] data      Puntero al primer byte del entero
+ * @return              Valor del entero
+ */
+static uint32_t Read32(const uint8_t* data);
+
+/**
+ * @brief Función para obtener el nombre de un servicio del sistema
+ *
+ * @param[in] service   Numero del servicio, definido en eos_services_t
+ * @return              Nombre del servicio o NULL si no se reconoce
+ */
+static const char* ServiceName(uint16_t service);
+
+/**
+ * @brief Función para escribir el comienzo de un evento y el nombre del hilo si es necesario
+ *
+ * @param[in] self      Puntero al estado de la conversión
+ * @param[in] tid       Hilo al que pertenece el evento
+ * @param[in] phase     Tipo de evento en el formato de trazas de Chrome
+ */
+static void EventBegin(decoder_t self, int tid, char phase);
+
+/**
+ * @brief Función para escribir un intervalo que comienza o termina en el instante actual
+ *
+ * @param[in] self      Puntero al estado de la conversión
+ * @param[in] tid       Hilo al que pertenece el intervalo
+ * @param[in] begin     Indica si el intervalo comienza o termina
+ */
+static void Slice(decoder_t self, int tid, bool begin);
+
+/**
+ * @brief Función para escribir un evento instantaneo con un argumento
+ *
+ * @param[in] self      Puntero al estado de la conversión
+ * @param[in] tid       Hilo al que pertenece el evento
+ * @param[in] name      Nombre del evento
+ * @param[in] argument  Nombre del argumento del evento
+ * @param[in] value     Valor del argumento del evento
+ */
+static void Instant(decoder_t self, int tid, const char* name, const char* argument, int value);
+
+/**
+ * @brief Función para convertir un evento del registro
+ *
+ * @param[in] self      Puntero al estado de la conversión
+ * @param[in] record    Puntero al evento en el volcado
+ */
+static void DecodeRecord(decoder_t self, const uint8_t* record);
+
+/* === Definiciones de variables internas ====================================================== */
+
+//! Nombres de los servicios del sistema en el orden de eos_services_t
+static const char* const SERVICES[] = {
+    "DELAY", "YIELD", "GIVE", "TAKE", "QUEUE_GIVE", "QUEUE_TAKE", "QUEUE_RESERVE",
+    "QUEUE_COMMIT", "QUEUE_ACQUIRE", "QUEUE_RELEASE", "STREAM_WAIT", "STREAM_WAKEUP",
+    "POOL_ALLOCATE", "POOL_FREE", "MUTEX_LOCK", "MUTEX_UNLOCK", "TASK_PRIORITY",
+    "TASK_THRESHOLD", "WAIT_UNTIL", "TASK_STATS", "HANDLER_STATS", "HANDLER_LATENCY",
+};
+
+_Static_assert(sizeof(SERVICES) / sizeof(SERVICES[0]) == EOS_SERVICE_END - EOS_SERVICE_DELAY,
+    "La tabla de nombres no coincide con los servicios del sistema");
+
+/* === Definiciones de variables externas ====================================================== */
+
+/* === Definiciones de funciones internas ====================================================== */
+
+static uint16_t Read16(const uint8_t* data)
+{
+    return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+static uint32_t Read32(const uint8_t* data)
+{
+    return (uint32_t)Read16(data) | ((uint32_t)Read16(data + 2) << 16);
+}
+
+static const char* ServiceName(uint16_t service)
+{
+    const char* result = NULL;
+
+    if (service >= EOS_SERVICE_DELAY && service < EOS_SERVICE_END) {
+        result = SERVICES[service - EOS_SERVICE_DELAY];
+    }
+    return result;
+}
+
+static void EventBegin(decoder_t self, int tid, char phase)
+{
+    if (!self->named[tid]) {
+        self->named[tid] = true;
+        fprintf(self->output, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,",
+            self->first ? "" : ",", tid);
+        if (tid >= TRACE_HANDLER_TID) {
+            fprintf(self->output, "\"args\":{\"name\":\"IRQ %d\"}}", tid - TRACE_HANDLER_TID);
+        } else if (tid > 0) {
+            fprintf(self->output, "\"args\":{\"name\":\"Tarea %d\"}}", tid);
+        } else {
+            fprintf(self->output, "\"args\":{\"name\":\"Inactiva\"}}");
+        }
+        self->first = false;
+    }
+
+    fprintf(self->output, "%s\n{\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%.3f",
+        self->first ? "" : ",", phase, tid, (double)self->cycles * 1e6 / self->frequency);
+    self->first = false;
+}
+
+static void Slice(decoder_t self, int tid, bool begin)
+{
+    if (begin) {
+        EventBegin(self, tid, 'B');
+        fprintf(self->output, ",\"name\":\"%s\"}", tid >= TRACE_HANDLER_TID ? "IRQ" : "Ejecucion");
+        self->open[tid]++;
+    } else if (self->open[tid]) {
+        // Un intervalo que comenzó antes del evento mas antiguo del registro no se cierra
+        EventBegin(self, tid, 'E');
+        fprintf(self->output, "}");
+        self->open[tid]--;
+    }
+}
+
+static void Instant(decoder_t self, int tid, const char* name, const char* argument, int value)
+{
+    EventBegin(self, tid, 'i');
+    fprintf(self->output, ",\"s\":\"t\",\"name\":\"%s\",\"args\":{\"%s\":%d}}", name, argument,
+        value);
+}
+
+static void DecodeRecord(decoder_t self, const uint8_t* record)
+{
+    uint32_t time = Read32(record);
+    uint8_t event = record[4];
+    int task = record[5];
+    uint16_t data = Read16(record + 6);
+    const char* name;
+
+    // La diferencia sin signo descarta los desbordes del contador de 32 bits
+    self->cycles += (uint32_t)(time - self->time);
+    self->time = time;
+
+    switch (event) {
+    case TRACE_SWITCH:
+        if (self->running >= 0) {
+            Slice(self, self->running, false);
+        }
+        Slice(self, task, true);
+        self->running = task;
+        break;
+    case TRACE_SERVICE:
+        name = ServiceName(data);
+        Instant(self, task, name ? name : "SERVICE", "servicio", data);
+        break;
+    case TRACE_SEMAPHORE_GIVE:
+        Instant(self, task, "SEMAPHORE_GIVE", "semaforo", data);
+        break;
+    case TRACE_SEMAPHORE_TAKE:
+        Instant(self, task, "SEMAPHORE_TAKE", "semaforo", data);
+        break;
+    case TRACE_SEMAPHORE_BLOCK:
+        Instant(self, task, "SEMAPHORE_BLOCK", "semaforo", data);
+        break;
+    case TRACE_QUEUE_GIVE:
+        Instant(self, task, "QUEUE_GIVE", "cola", data);
+        break;
+    case TRACE_QUEUE_TAKE:
+        Instant(self, task, "QUEUE_TAKE", "cola", data);
+        break;
+    case TRACE_QUEUE_BLOCK:
+        Instant(self, task, "QUEUE_BLOCK", "cola", data);
+        break;
+    case TRACE_HANDLER_ENTER:
+        Slice(self, TRACE_HANDLER_TID + data, true);
+        break;
+    case TRACE_HANDLER_EXIT:
+        Slice(self, TRACE_HANDLER_TID + data, false);
+        break;
+    default:
+        Instant(self, task, "DESCONOCIDO", "evento", event);
+        break;
+    }
+}
+
+/* === Definiciones de funciones externas ====================================================== */
+
+int TraceDecode(const uint8_t* dump, size_t size, FILE* output)
+{
+    decoder_t self;
+    uint32_t capacity, written, count, first, index;
+
+    if (size < HEADER_SIZE || Read32(dump) != TRACE_MAGIC || Read16(dump + 4) != TRACE_VERSION) {
+        fprintf(stderr, "El volcado no contiene un registro de eventos reconocido\n");
+        return 1;
+    }
+
+    capacity = Read16(dump + 6);
+    written = Read32(dump + 12);
+    if (capacity == 0 || size < HEADER_SIZE + (size_t)capacity * RECORD_SIZE) {
+        fprintf(stderr, "El volcado no contiene todos los eventos del registro\n");
+        return 1;
+    }
+
+    self = calloc(1, sizeof(struct decoder_s));
+    if (self == NULL) {
+        fprintf(stderr, "No hay memoria suficiente para la conversión\n");
+        return 1;
+    }
+    self->output = output;
+    self->first = true;
+    self->running = -1;
+    self->frequency = Read32(dump + 8);
+    if (self->frequency == 0) {
+        // El registro no se inició con el planificador, los tiempos se expresan en ciclos
+        self->frequency = 1000000;
+    }
+
+    // Con el registro lleno el evento mas antiguo es el siguiente al ultimo escrito
+    count = (written < capacity) ? written : capacity;
+    first = (written < capacity) ? 0 : written % capacity;
+
+    fprintf(output, "{\"traceEvents\":[");
+    for (index = 0; index < count; index++) {
+        const uint8_t* record = dump + HEADER_SIZE + ((first + index) % capacity) * RECORD_SIZE;
+        if (index == 0) {
+            self->time = Read32(record);
+        }
+        DecodeRecord(self, record);
+    }
+
+    // Los intervalos abiertos al momento del volcado se cierran en el ultimo evento
+    for (index = 0; index < THREAD_COUNT; index++) {
+        while (self->open[index]) {
+            Slice(self, index, false);
+        }
+    }
+    fprintf(output, "\n],\"displayTimeUnit\":\"ns\"}\n");
+
+    free(self);
+    return 0;
+}
+
+#ifndef TEST
+int main(int argc, char* argv[])
+{
+    FILE* input;
+    FILE* output = stdout;
+    uint8_t* dump;
+    long size;
+    int result = 1;
+
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Uso: %s volcado.bin [traza.json]\n", argv[0]);
+        return 1;
+    }
+
+    input = fopen(argv[1], "rb");
+    if (input == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    fseek(input, 0, SEEK_END);
+    size = ftell(input);
+    fseek(input, 0, SEEK_SET);
+
+    dump = malloc(size > 0 ? size : 1);
+    if (dump && fread(dump, 1, size, input) == (size_t)size) {
+        if (argc == 3) {
+            output = fopen(argv[2], "w");
+            if (output == NULL) {
+                perror(argv[2]);
+            }
+        }
+        if (output) {
+            result = TraceDecode(dump, size, output);
+        }
+        if (output && output != stdout) {
+            fclose(output);
+        }
+    }
+    free(dump);
+    fclose(input);
+    return result;
+}
+#endif
+
+/* === Ciere de documentacion ================================================================== */
+
+/** @} Final de la definición del modulo para doxygen */